@@ -0,0 +1,220 @@
+#include "catch2/catch.hpp"
+#include "../resources/random.hpp"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace nvs;
+
+TEST_CASE("philox4x32::block", "[philox4x32][block]") {
+    // vecteurs de référence de Random123 (kat_vectors, philox4x32 10 tours)
+    using block_t = std::array<std::uint32_t, 4>;
+    REQUIRE(philox4x32::block({0, 0, 0, 0}, {0, 0})
+            == block_t{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    REQUIRE(philox4x32::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff})
+            == block_t{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    REQUIRE(philox4x32::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0})
+            == block_t{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("philox4x32::discard", "[philox4x32][discard]") {
+    philox4x32 reference{42, 7};
+    std::vector<std::uint32_t> values(1000);
+    for (auto &value : values) {
+        value = reference();
+    }
+
+    for (unsigned long long skip : {0ull, 1ull, 3ull, 4ull, 5ull, 257ull, 998ull}) {
+        philox4x32 u{42, 7};
+        u.discard(skip);
+        REQUIRE(u() == values[skip]);
+
+        philox4x32 v{42, 7};
+        v();
+        v.discard(skip);
+        REQUIRE(v() == values[skip + 1]);
+    }
+
+    philox4x32 u{42, 7};
+    u.discard(1000);
+    REQUIRE(u == reference);
+}
+
+TEST_CASE("philox4x32 flux", "[philox4x32][split]") {
+    philox4x32 u{42};
+    philox4x32 v = u.split(1);
+    REQUIRE(v.seed() == 42);
+    REQUIRE(v.stream() == 1);
+    REQUIRE(u != v);
+
+    std::set<std::uint32_t> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.insert(u());
+        values.insert(v());
+    }
+    REQUIRE(values.size() > 1990);
+
+    std::uniform_int_distribution<int> d{1, 6};
+    philox4x32 w{42};
+    REQUIRE(d(w) >= 1);
+}
+
+TEST_CASE("thread_urng", "[thread_urng]") {
+    std::uint64_t main_stream = thread_urng().stream();
+    std::uint64_t other_stream = main_stream;
+    std::thread other{[&other_stream]() { other_stream = thread_urng().stream(); }};
+    other.join();
+
+    REQUIRE(other_stream != main_stream);
+    REQUIRE(&thread_urng() == &thread_urng());
+}
+
+TEST_CASE("xoshiro256pp", "[xoshiro256pp]") {
+    xoshiro256pp u{42};
+    xoshiro256pp v{42};
+    REQUIRE(u == v);
+    REQUIRE(u() == v());
+
+    v.discard(10);
+    for (int i = 0; i < 10; ++i) {
+        u();
+    }
+    REQUIRE(u == v);
+
+    v.jump();
+    REQUIRE(u != v);
+    REQUIRE(u() != v());
+}
+
+TEST_CASE("fill_uniform entiers", "[fill_uniform]") {
+    xoshiro256pp u{42};
+
+    std::vector<int> dice(60000);
+    fill_uniform(dice.begin(), dice.end(), 6, 1, u);
+    std::vector<int> counts(7);
+    for (int value : dice) {
+        REQUIRE(1 <= value);
+        REQUIRE(value <= 6);
+        ++counts[value];
+    }
+    for (int face = 1; face <= 6; ++face) {
+        REQUIRE(counts[face] == Approx(10000).epsilon(.05));
+    }
+
+    std::vector<long long> wide(1000);
+    fill_uniform(wide.begin(), wide.end(), -(1ll << 40), 1ll << 40, u);
+    for (long long value : wide) {
+        REQUIRE(-(1ll << 40) <= value);
+        REQUIRE(value <= 1ll << 40);
+    }
+
+    std::vector<std::int8_t> bytes(10000);
+    fill_uniform(bytes.begin(), bytes.end(), std::int8_t{-128}, std::int8_t{127}, u);
+    REQUIRE(std::set<std::int8_t>(bytes.begin(), bytes.end()).size() == 256);
+
+    std::vector<std::uint64_t> all(1000);
+    fill_uniform(all.begin(), all.end(), std::uint64_t{0}, ~std::uint64_t{0});
+    REQUIRE(std::set<std::uint64_t>(all.begin(), all.end()).size() == all.size());
+
+    philox4x32 p1{7};
+    philox4x32 p2{7};
+    std::vector<unsigned> lhs(100);
+    std::vector<unsigned> rhs(100);
+    fill_uniform(lhs.begin(), lhs.end(), 0u, 1000u, p1);
+    fill_uniform(rhs.begin(), rhs.end(), 0u, 1000u, p2);
+    REQUIRE(lhs == rhs);
+}
+
+TEST_CASE("fill_uniform flottants", "[fill_uniform]") {
+    std::vector<double> values(100000);
+    fill_uniform(values.data(), values.data() + values.size(), 10., -10.);
+
+    double sum = 0.;
+    for (double value : values) {
+        REQUIRE(-10. <= value);
+        REQUIRE(value < 10.);
+        sum += value;
+    }
+    REQUIRE(sum / values.size() == Approx(0.).margin(.1));
+}
+
+TEST_CASE("seed", "[seed][urng]") {
+    auto u = urng(seed{42, 3});
+    auto v = urng(seed{42, 3});
+    auto w = urng(seed{42, 4});
+    REQUIRE(u == v);
+    REQUIRE(u.stream() == 3);
+    REQUIRE(u != w);
+
+    std::vector<int> lhs(100);
+    std::vector<int> rhs(100);
+    std::thread other{[&rhs]() {
+        auto engine = urng(seed{42, 3});
+        for (auto &value : rhs) {
+            value = random_value(-5, 5, engine);
+        }
+    }};
+    for (auto &value : lhs) {
+        value = random_value(-5, 5, u);
+    }
+    other.join();
+    REQUIRE(lhs == rhs);
+
+    double real = random_value(2., -2., v);
+    REQUIRE(-2. <= real);
+    REQUIRE(real < 2.);
+    REQUIRE(random_seed(5).stream == 5);
+}
+
+TEST_CASE("random_sample", "[random_sample]") {
+    xoshiro256pp u{42};
+
+    auto big = random_sample(8, 1u, 1000000000u, u);
+    REQUIRE(big.size() == 8);
+    REQUIRE(std::is_sorted(big.begin(), big.end()));
+    REQUIRE(std::adjacent_find(big.begin(), big.end()) == big.end());
+    REQUIRE(big.front() >= 1u);
+    REQUIRE(big.back() <= 1000000000u);
+
+    auto all = random_sample(10, -5, 4, u);
+    REQUIRE(all == std::vector<int>{-5, -4, -3, -2, -1, 0, 1, 2, 3, 4});
+
+    auto many = random_sample(1000, 0ull, 4999ull, u);
+    REQUIRE(many.size() == 1000);
+    REQUIRE(std::is_sorted(many.begin(), many.end()));
+    REQUIRE(std::adjacent_find(many.begin(), many.end()) == many.end());
+    REQUIRE(many.back() < 5000);
+
+    REQUIRE(random_sample(0, 1, 1, u).empty());
+    REQUIRE_THROWS_AS(random_sample(3, 1, 2, u), std::invalid_argument);
+
+    // les 10 paires de {0, ..., 4} doivent être équiprobables
+    std::vector<int> counts(25);
+    for (int i = 0; i < 100000; ++i) {
+        auto pair = random_sample(2, 0, 4, u);
+        ++counts[pair[0] * 5 + pair[1]];
+    }
+    for (int a = 0; a < 5; ++a) {
+        for (int b = a + 1; b < 5; ++b) {
+            REQUIRE(counts[a * 5 + b] == Approx(10000).epsilon(.05));
+        }
+    }
+}
+
+TEST_CASE("fill_sample", "[fill_sample]") {
+    xoshiro256pp u{7};
+    std::vector<unsigned> buffer(24);
+    for (int i = 0; i < 1000; ++i) {
+        for (std::size_t grid = 0; grid < 3; ++grid) {
+            fill_sample(buffer.begin() + 8 * grid, buffer.begin() + 8 * (grid + 1), 1u, 45u, u);
+        }
+        for (std::size_t grid = 0; grid < 3; ++grid) {
+            auto first = buffer.begin() + 8 * grid;
+            REQUIRE(std::is_sorted(first, first + 8));
+            REQUIRE(std::adjacent_find(first, first + 8) == first + 8);
+            REQUIRE(*first >= 1u);
+            REQUIRE(*(first + 7) <= 45u);
+        }
+    }
+}
@@ -0,0 +1 @@
+../../td04/src/PrimeFactorizationArena.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../td04/src/PrimeFactorizationArena.h
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include "primestat.h"
 #include "statsample.h"
+#include "statreduce.h"
+#include "quantilesketch.h"
 #include "../resources/td04.h"
 
 int main() {
@@ -32,6 +34,47 @@ int main() {
     printf("la moyenne des nombres de facteurs premiers des nombre entre [%d, %d] est %f", lower, higher,
            sample_avg(s));
 
+    puts("\n\n\t===STATISTIQUES EN FLUX===");
+    StatSample stream;
+    init_stat_streaming(&stream, 1000);
+    for (size_t i = 0; i < s.length; ++i) {
+        update_stat(s.data[i], &stream);
+    }
+    printf("n = %llu, moyenne = %f, variance = %f, asymétrie = %f, min = %d, max = %d\n",
+           stream.count, sample_avg(stream), sample_variance(&stream), sample_skewness(&stream),
+           sample_min(&stream), sample_max(&stream));
+    printf("médiane exacte = %f, médiane du réservoir = %f\n",
+           sample_quantile(&s, .5), sample_quantile(&stream, .5));
+
+    puts("\n\t===STATISTIQUES EN PARALLELE===");
+    size_t size = 10000000;
+    int *values = malloc(sizeof(int) * size);
+    if (values != NULL) {
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = (int) ((i * 2654435761u) % 1000);
+        }
+        StatSample parallel;
+        init_stat_streaming(&parallel, 0);
+        stat_parallel_reduce(values, size, 8, &parallel);
+        printf("n = %llu, moyenne = %f, variance = %f, min = %d, max = %d\n",
+               parallel.count, sample_avg(parallel), sample_variance(&parallel),
+               sample_min(&parallel), sample_max(&parallel));
+        free_stat(&parallel);
+
+        QuantileSketch sketch;
+        if (init_sketch(&sketch, QUANTILESKETCH_DEFAULT_K)) {
+            for (size_t i = 0; i < size; ++i) {
+                update_sketch(values[i], &sketch);
+            }
+            printf("sketch KLL : %zu valeurs retenues, médiane = %f, p99 = %f (erreur de rang ~%.2f %%)\n",
+                   sketch_retained(&sketch), sketch_quantile(&sketch, .5), sketch_quantile(&sketch, .99),
+                   100 * sketch_rank_error(sketch.k));
+            free_sketch(&sketch);
+        }
+        free(values);
+    }
+
+    free_stat(&stream);
     free_stat(&s);
     return 0;
 }
@@ -0,0 +1,317 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "quantilesketch.h"
+
+typedef struct WeightedItem {
+    double value;
+    unsigned long long weight;
+} WeightedItem;
+
+static size_t level_capacity(const QuantileSketch *sketch, unsigned level);
+
+static size_t total_capacity(const QuantileSketch *sketch);
+
+static bool add_level(QuantileSketch *sketch);
+
+static bool reserve_level(QuantileSketch *sketch, unsigned level, size_t size);
+
+static bool compress(QuantileSketch *sketch);
+
+static WeightedItem *sorted_items(const QuantileSketch *sketch, size_t *length);
+
+static unsigned long long next_random(QuantileSketch *sketch);
+
+static int compare_double(const void *lhs, const void *rhs);
+
+static int compare_item(const void *lhs, const void *rhs);
+
+bool init_sketch(QuantileSketch *sketch, unsigned k) {
+    assert(sketch != NULL);
+    assert(k >= 8);
+
+    sketch->k = k;
+    sketch->count = 0;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+    sketch->retained = 0;
+    sketch->capacity = 0;
+    sketch->levels = 0;
+    sketch->allocated_levels = 0;
+    sketch->items = NULL;
+    sketch->sizes = NULL;
+    sketch->capacities = NULL;
+    sketch->state = 0x2545F4914F6CDD1DULL;
+
+    return add_level(sketch);
+}
+
+void free_sketch(QuantileSketch *sketch) {
+    assert(sketch != NULL);
+
+    for (unsigned h = 0; h < sketch->levels; ++h) {
+        free(sketch->items[h]);
+    }
+    free(sketch->items);
+    free(sketch->sizes);
+    free(sketch->capacities);
+    sketch->items = NULL;
+    sketch->sizes = NULL;
+    sketch->capacities = NULL;
+    sketch->levels = 0;
+    sketch->allocated_levels = 0;
+}
+
+bool update_sketch(double value, QuantileSketch *sketch) {
+    assert(sketch != NULL);
+
+    if (!reserve_level(sketch, 0, sketch->sizes[0] + 1)) {
+        return false;
+    }
+
+    sketch->items[0][(sketch->sizes[0])++] = value;
+    (sketch->retained)++;
+    (sketch->count)++;
+    if (value < sketch->min) {
+        sketch->min = value;
+    }
+    if (value > sketch->max) {
+        sketch->max = value;
+    }
+
+    return compress(sketch);
+}
+
+bool merge_sketch(QuantileSketch *into, const QuantileSketch *from) {
+    assert(into != NULL);
+    assert(from != NULL);
+    assert(into != from);
+    assert(into->k == from->k);
+
+    while (into->levels < from->levels) {
+        if (!add_level(into)) {
+            return false;
+        }
+    }
+
+    for (unsigned h = 0; h < from->levels; ++h) {
+        if (!reserve_level(into, h, into->sizes[h] + from->sizes[h])) {
+            return false;
+        }
+        memcpy(into->items[h] + into->sizes[h], from->items[h], sizeof(double) * from->sizes[h]);
+        into->sizes[h] += from->sizes[h];
+    }
+    into->retained += from->retained;
+
+    into->count += from->count;
+    if (from->min < into->min) {
+        into->min = from->min;
+    }
+    if (from->max > into->max) {
+        into->max = from->max;
+    }
+
+    return compress(into);
+}
+
+double sketch_quantile(const QuantileSketch *sketch, double q) {
+    assert(sketch != NULL);
+    assert(sketch->count != 0);
+    assert(0. <= q && q <= 1.);
+
+    if (q == 0.) {
+        return sketch->min;
+    }
+    if (q == 1.) {
+        return sketch->max;
+    }
+
+    size_t length;
+    WeightedItem *items = sorted_items(sketch, &length);
+    if (items == NULL) {
+        return NAN;
+    }
+
+    double target = q * (double) sketch->count;
+    unsigned long long cumulative = 0;
+    double result = sketch->max;
+    for (size_t i = 0; i < length; ++i) {
+        cumulative += items[i].weight;
+        if ((double) cumulative >= target) {
+            result = items[i].value;
+            break;
+        }
+    }
+
+    free(items);
+
+    return result;
+}
+
+double sketch_rank(const QuantileSketch *sketch, double value) {
+    assert(sketch != NULL);
+    assert(sketch->count != 0);
+
+    unsigned long long below = 0;
+    for (unsigned h = 0; h < sketch->levels; ++h) {
+        for (size_t i = 0; i < sketch->sizes[h]; ++i) {
+            if (sketch->items[h][i] <= value) {
+                below += 1ULL << h;
+            }
+        }
+    }
+
+    return (double) below / (double) sketch->count;
+}
+
+double sketch_rank_error(unsigned k) {
+    // ajustement empirique de la bibliothèque DataSketches pour KLL
+    return 2.296 / pow(k, 0.9723);
+}
+
+size_t sketch_retained(const QuantileSketch *sketch) {
+    assert(sketch != NULL);
+
+    return sketch->retained;
+}
+
+static size_t level_capacity(const QuantileSketch *sketch, unsigned level) {
+    unsigned depth = sketch->levels - 1 - level;
+    size_t capacity = (size_t) ceil(sketch->k * pow(2. / 3., depth));
+
+    return capacity < 2 ? 2 : capacity;
+}
+
+static size_t total_capacity(const QuantileSketch *sketch) {
+    size_t capacity = 0;
+    for (unsigned h = 0; h < sketch->levels; ++h) {
+        capacity += level_capacity(sketch, h);
+    }
+
+    return capacity;
+}
+
+static bool add_level(QuantileSketch *sketch) {
+    if (sketch->levels == sketch->allocated_levels) {
+        unsigned allocated = sketch->allocated_levels == 0 ? 8 : 2 * sketch->allocated_levels;
+        double **items = realloc(sketch->items, sizeof(double *) * allocated);
+        if (items == NULL) {
+            return false;
+        }
+        sketch->items = items;
+        size_t *sizes = realloc(sketch->sizes, sizeof(size_t) * allocated);
+        if (sizes == NULL) {
+            return false;
+        }
+        sketch->sizes = sizes;
+        size_t *capacities = realloc(sketch->capacities, sizeof(size_t) * allocated);
+        if (capacities == NULL) {
+            return false;
+        }
+        sketch->capacities = capacities;
+        sketch->allocated_levels = allocated;
+    }
+
+    sketch->items[sketch->levels] = NULL;
+    sketch->sizes[sketch->levels] = 0;
+    sketch->capacities[sketch->levels] = 0;
+    (sketch->levels)++;
+    sketch->capacity = total_capacity(sketch);
+
+    return true;
+}
+
+static bool reserve_level(QuantileSketch *sketch, unsigned level, size_t size) {
+    if (size <= sketch->capacities[level]) {
+        return true;
+    }
+
+    size_t capacity = 2 * sketch->capacities[level];
+    if (capacity < size) {
+        capacity = size < sketch->k ? sketch->k : size;
+    }
+
+    double *items = realloc(sketch->items[level], sizeof(double) * capacity);
+    if (items == NULL) {
+        return false;
+    }
+    sketch->items[level] = items;
+    sketch->capacities[level] = capacity;
+
+    return true;
+}
+
+static bool compress(QuantileSketch *sketch) {
+    while (sketch->retained >= sketch->capacity) {
+        unsigned h = 0;
+        while (sketch->sizes[h] < level_capacity(sketch, h)) {
+            ++h;
+        }
+
+        if (h == sketch->levels - 1 && !add_level(sketch)) {
+            return false;
+        }
+
+        size_t size = sketch->sizes[h];
+        size_t odd = size % 2;
+        size_t promoted = size / 2;
+        if (!reserve_level(sketch, h + 1, sketch->sizes[h + 1] + promoted)) {
+            return false;
+        }
+
+        double *items = sketch->items[h];
+        qsort(items, size, sizeof(double), compare_double);
+
+        // une valeur isolée reste en place si la taille est impaire
+        size_t offset = odd + (next_random(sketch) & 1ULL);
+        double *upper = sketch->items[h + 1] + sketch->sizes[h + 1];
+        for (size_t i = 0; i < promoted; ++i) {
+            upper[i] = items[offset + 2 * i];
+        }
+        sketch->sizes[h + 1] += promoted;
+        sketch->sizes[h] = odd;
+        sketch->retained -= size - odd - promoted;
+    }
+
+    return true;
+}
+
+static WeightedItem *sorted_items(const QuantileSketch *sketch, size_t *length) {
+    *length = sketch_retained(sketch);
+    WeightedItem *items = malloc(sizeof(WeightedItem) * *length);
+    if (items == NULL) {
+        return NULL;
+    }
+
+    size_t k = 0;
+    for (unsigned h = 0; h < sketch->levels; ++h) {
+        for (size_t i = 0; i < sketch->sizes[h]; ++i) {
+            items[k].value = sketch->items[h][i];
+            items[k].weight = 1ULL << h;
+            ++k;
+        }
+    }
+    qsort(items, *length, sizeof(WeightedItem), compare_item);
+
+    return items;
+}
+
+static unsigned long long next_random(QuantileSketch *sketch) {
+    // splitmix64
+    unsigned long long z = (sketch->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static int compare_double(const void *lhs, const void *rhs) {
+    double a = *(const double *) lhs;
+    double b = *(const double *) rhs;
+
+    return (a > b) - (a < b);
+}
+
+static int compare_item(const void *lhs, const void *rhs) {
+    return compare_double(&((const WeightedItem *) lhs)->value, &((const WeightedItem *) rhs)->value);
+}
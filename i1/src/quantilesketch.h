@@ -0,0 +1,55 @@
+#ifndef DEV3_QUANTILESKETCH_H
+#define DEV3_QUANTILESKETCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// paramètre de précision par défaut, erreur de rang normalisée ~1,3 %
+#define QUANTILESKETCH_DEFAULT_K 200
+
+/*
+ * Sketch KLL (Karnin, Lang, Liberty) pour quantiles approchés.
+ *
+ * Les valeurs du niveau h représentent chacune 2^h valeurs vues. Quand
+ * un niveau dépasse sa capacité, il est trié et une valeur sur deux
+ * (la paire ou l'impaire, tiré à pile ou face) monte au niveau
+ * suivant. Les capacités décroissent d'un facteur 2/3 en descendant
+ * depuis le niveau le plus haut, la mémoire reste en O(k log(n/k)) au
+ * pire et la plupart du temps proche de 3k valeurs.
+ */
+typedef struct QuantileSketch {
+    unsigned k;
+    unsigned long long count;
+    double min;
+    double max;
+    size_t retained;
+    size_t capacity;
+    unsigned levels;
+    unsigned allocated_levels;
+    double **items;
+    size_t *sizes;
+    size_t *capacities;
+    unsigned long long state;
+} QuantileSketch;
+
+bool init_sketch(QuantileSketch *sketch, unsigned k);
+
+void free_sketch(QuantileSketch *sketch);
+
+bool update_sketch(double value, QuantileSketch *sketch);
+
+// fusionne from dans into, les deux doivent avoir le même k
+bool merge_sketch(QuantileSketch *into, const QuantileSketch *from);
+
+// plus petite valeur retenue dont le rang normalisé atteint q
+double sketch_quantile(const QuantileSketch *sketch, double q);
+
+// proportion estimée des valeurs vues inférieures ou égales à value
+double sketch_rank(const QuantileSketch *sketch, double value);
+
+// erreur de rang normalisée attendue (99 % de confiance) pour k
+double sketch_rank_error(unsigned k);
+
+size_t sketch_retained(const QuantileSketch *sketch);
+
+#endif //DEV3_QUANTILESKETCH_H
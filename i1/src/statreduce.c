@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "statreduce.h"
+
+typedef struct StatChunk {
+    const int *values;
+    size_t length;
+    StatSample sample;
+} StatChunk;
+
+static void *reduce_chunk(void *argument) {
+    StatChunk *chunk = argument;
+    // copie locale : les échantillons voisins dans chunks partagent
+    // des lignes de cache, ils ne sont écrits qu'une fois à la fin
+    StatSample sample = chunk->sample;
+
+    for (size_t i = 0; i < chunk->length; ++i) {
+        update_stat(chunk->values[i], &sample);
+    }
+
+    chunk->sample = sample;
+
+    return NULL;
+}
+
+void stat_parallel_reduce(const int *values, size_t length, unsigned threads, StatSample *into) {
+    assert(values != NULL || length == 0);
+    assert(into != NULL);
+
+    if (threads <= 1 || length < threads) {
+        StatChunk chunk = {values, length, *into};
+        reduce_chunk(&chunk);
+        *into = chunk.sample;
+        return;
+    }
+
+    StatChunk *chunks = malloc(sizeof(StatChunk) * threads);
+    pthread_t *ids = malloc(sizeof(pthread_t) * threads);
+    bool *started = malloc(sizeof(bool) * threads);
+
+    if (chunks == NULL || ids == NULL || started == NULL) {
+        free(chunks);
+        free(ids);
+        free(started);
+        stat_parallel_reduce(values, length, 1, into);
+        return;
+    }
+
+    size_t step = length / threads;
+    for (unsigned t = 0; t < threads; ++t) {
+        chunks[t].values = values + t * step;
+        chunks[t].length = t == threads - 1 ? length - t * step : step;
+        if (into->mode == STAT_STREAMING) {
+            init_stat_streaming(&(chunks[t].sample), into->capacity);
+        } else {
+            init_stat(&(chunks[t].sample));
+        }
+        chunks[t].sample.state ^= (unsigned long long) (t + 1) << 32;
+        started[t] = pthread_create(&ids[t], NULL, reduce_chunk, &chunks[t]) == 0;
+        if (!started[t]) {
+            reduce_chunk(&chunks[t]);
+        }
+    }
+
+    for (unsigned t = 0; t < threads; ++t) {
+        if (started[t]) {
+            pthread_join(ids[t], NULL);
+        }
+        merge_stat(into, &(chunks[t].sample));
+        free_stat(&(chunks[t].sample));
+    }
+
+    free(started);
+    free(ids);
+    free(chunks);
+}
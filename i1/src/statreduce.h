@@ -0,0 +1,10 @@
+#ifndef DEV3_STATREDUCE_H
+#define DEV3_STATREDUCE_H
+
+#include <stddef.h>
+#include "statsample.h"
+
+// répartit values entre threads accumulateurs puis les fusionne dans into
+void stat_parallel_reduce(const int *values, size_t length, unsigned threads, StatSample *into);
+
+#endif //DEV3_STATREDUCE_H
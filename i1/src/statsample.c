@@ -1,45 +1,219 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
 #include "statsample.h"
 
 static void double_capacity(StatSample *s);
 
-void init_stat(StatSample *s) {
-    assert(s != NULL);
+static void update_moments(int n, StatSample *s);
+
+static void update_reservoir(int n, StatSample *s);
+
+static void merge_reservoir(StatSample *into, const StatSample *from);
+
+static unsigned long long next_random(StatSample *s);
+
+static int compare_int(const void *lhs, const void *rhs);
+
+static void init_moments(StatSample *s) {
     s->count = 0;
     s->sum = 0;
+    s->mean = 0.;
+    s->m2 = 0.;
+    s->m3 = 0.;
+    s->min = INT_MAX;
+    s->max = INT_MIN;
+    s->length = 0;
+    s->state = 0x9E3779B97F4A7C15ULL;
+}
+
+void init_stat(StatSample *s) {
+    assert(s != NULL);
+    init_moments(s);
+    s->mode = STAT_STORE_ALL;
     s->data = malloc(sizeof(int) * 10);
     s->capacity = 10;
 }
 
+void init_stat_streaming(StatSample *s, size_t reservoir) {
+    assert(s != NULL);
+    init_moments(s);
+    s->mode = STAT_STREAMING;
+    s->data = reservoir == 0 ? NULL : malloc(sizeof(int) * reservoir);
+    s->capacity = s->data == NULL ? 0 : reservoir;
+}
+
 void free_stat(StatSample *s) {
     assert(s != NULL);
-    assert(s->data != NULL);
+    assert(s->mode == STAT_STREAMING || s->data != NULL);
 
     free(s->data);
     s->data = NULL;
+    s->length = 0;
     s->capacity = 0;
 }
 
 void update_stat(int n, StatSample *s) {
     assert(s != NULL);
+
+    update_moments(n, s);
+
+    if (s->mode == STAT_STREAMING) {
+        update_reservoir(n, s);
+        return;
+    }
+
     assert(s->data != NULL);
 
-    if (s->capacity == s->count) {
+    if (s->capacity == s->length) {
         double_capacity(s);
     }
 
-    s->data[s->count] = n;
-    (s->count)++;
+    s->data[s->length] = n;
+    (s->length)++;
+}
+
+static void update_moments(int n, StatSample *s) {
+    double count = (double) ++(s->count);
+    double delta = n - s->mean;
+    double delta_n = delta / count;
+    double term = delta * delta_n * (count - 1);
+
+    s->mean += delta_n;
+    s->m3 += term * delta_n * (count - 2) - 3 * delta_n * s->m2;
+    s->m2 += term;
     s->sum += n;
+
+    if (n < s->min) {
+        s->min = n;
+    }
+    if (n > s->max) {
+        s->max = n;
+    }
+}
+
+static void update_reservoir(int n, StatSample *s) {
+    if (s->length < s->capacity) {
+        s->data[s->length] = n;
+        (s->length)++;
+        return;
+    }
+
+    if (s->capacity == 0) {
+        return;
+    }
+
+    unsigned long long j = next_random(s) % s->count;
+    if (j < s->capacity) {
+        s->data[j] = n;
+    }
+}
+
+void merge_stat(StatSample *into, const StatSample *from) {
+    assert(into != NULL);
+    assert(from != NULL);
+    assert(into != from);
+
+    if (from->count == 0) {
+        return;
+    }
+
+    if (into->mode == STAT_STREAMING) {
+        merge_reservoir(into, from);
+    } else {
+        assert(into->data != NULL);
+        while (into->capacity - into->length < from->length) {
+            double_capacity(into);
+        }
+        memcpy(into->data + into->length, from->data, sizeof(int) * from->length);
+        into->length += from->length;
+    }
+
+    double na = (double) into->count;
+    double nb = (double) from->count;
+    double n = na + nb;
+    double delta = from->mean - into->mean;
+
+    into->m3 += from->m3
+                + delta * delta * delta * na * nb * (na - nb) / (n * n)
+                + 3 * delta * (na * from->m2 - nb * into->m2) / n;
+    into->m2 += from->m2 + delta * delta * na * nb / n;
+    into->mean += delta * nb / n;
+    into->count += from->count;
+    into->sum += from->sum;
+
+    if (from->min < into->min) {
+        into->min = from->min;
+    }
+    if (from->max > into->max) {
+        into->max = from->max;
+    }
+}
+
+static void merge_reservoir(StatSample *into, const StatSample *from) {
+    size_t length = into->length + from->length;
+    if (into->capacity == 0 || length == 0) {
+        return;
+    }
+
+    if (length <= into->capacity) {
+        memcpy(into->data + into->length, from->data, sizeof(int) * from->length);
+        into->length = length;
+        return;
+    }
+
+    int *pool = malloc(sizeof(int) * length);
+    if (pool == NULL) {
+        perror("Erreur lors de la fusion des réservoirs!");
+        return;
+    }
+    memcpy(pool, into->data, sizeof(int) * into->length);
+    memcpy(pool + into->length, from->data, sizeof(int) * from->length);
+
+    // tirage sans remise de capacity valeurs parmi les na + nb représentées :
+    // le nombre pris dans chaque réservoir suit la loi hypergéométrique,
+    // d'où la décrémentation de na ou nb à chaque place attribuée
+    size_t la = into->length;
+    size_t lb = from->length;
+    unsigned long long na = into->count;
+    unsigned long long nb = from->count;
+    for (size_t i = 0; i < into->capacity; ++i) {
+        bool from_a = lb == 0 || (la != 0 && next_random(into) % (na + nb) < na);
+        size_t k;
+        if (from_a) {
+            k = next_random(into) % la;
+            into->data[i] = pool[k];
+            pool[k] = pool[--la];
+            --na;
+        } else {
+            k = next_random(into) % lb;
+            into->data[i] = pool[into->length + k];
+            pool[into->length + k] = pool[into->length + --lb];
+            --nb;
+        }
+    }
+    into->length = into->capacity;
+
+    free(pool);
+}
+
+static unsigned long long next_random(StatSample *s) {
+    // splitmix64
+    unsigned long long z = (s->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
 }
 
 static void double_capacity(StatSample *s) {
     assert(s != NULL);
     assert(s->data != NULL);
 
-    int newCapacity = s->capacity * 2;
+    size_t newCapacity = s->capacity * 2;
     s->data = realloc(s->data, sizeof(int) * newCapacity);
 
     if (s->data == NULL) {
@@ -54,3 +228,71 @@ double sample_avg(StatSample s) {
 
     return s.sum / (double) s.count;
 }
+
+double sample_variance(const StatSample *s) {
+    assert(s != NULL);
+    assert(s->count != 0);
+
+    return s->count < 2 ? 0. : s->m2 / (double) (s->count - 1);
+}
+
+double sample_stddev(const StatSample *s) {
+    return sqrt(sample_variance(s));
+}
+
+double sample_skewness(const StatSample *s) {
+    assert(s != NULL);
+    assert(s->count != 0);
+
+    if (s->m2 == 0.) {
+        return 0.;
+    }
+
+    return sqrt((double) s->count) * s->m3 / pow(s->m2, 1.5);
+}
+
+int sample_min(const StatSample *s) {
+    assert(s != NULL);
+    assert(s->count != 0);
+
+    return s->min;
+}
+
+int sample_max(const StatSample *s) {
+    assert(s != NULL);
+    assert(s->count != 0);
+
+    return s->max;
+}
+
+double sample_quantile(const StatSample *s, double q) {
+    assert(s != NULL);
+    assert(s->length != 0);
+    assert(0. <= q && q <= 1.);
+
+    int *sorted = malloc(sizeof(int) * s->length);
+
+    if (sorted == NULL) {
+        perror("Erreur lors du calcul du quantile!");
+        return NAN;
+    }
+
+    memcpy(sorted, s->data, sizeof(int) * s->length);
+    qsort(sorted, s->length, sizeof(int), compare_int);
+
+    double position = q * (double) (s->length - 1);
+    size_t lower = (size_t) position;
+    size_t higher = lower + 1 < s->length ? lower + 1 : lower;
+    double result = sorted[lower] + (position - (double) lower) * (sorted[higher] - sorted[lower]);
+
+    free(sorted);
+
+    return result;
+}
+
+static int compare_int(const void *lhs, const void *rhs) {
+    int a = *(const int *) lhs;
+    int b = *(const int *) rhs;
+
+    return (a > b) - (a < b);
+}
@@ -1,21 +1,57 @@
-
-
 #ifndef DEV3_STATSAMPLE_H
 #define DEV3_STATSAMPLE_H
 
+#include <stddef.h>
+
+typedef enum StatMode {
+    // toutes les valeurs sont conservées dans data
+    STAT_STORE_ALL,
+    // seuls les moments et un réservoir de capacity valeurs sont conservés
+    STAT_STREAMING
+} StatMode;
+
 typedef struct StatSample {
-    int count;
-    int sum;
+    StatMode mode;
+    unsigned long long count;
+    long long sum;
+    // moments mis à jour à chaque valeur (Welford / Terriberry)
+    double mean;
+    double m2;
+    double m3;
+    int min;
+    int max;
     int *data;
-    int capacity;
+    size_t length;
+    size_t capacity;
+    // état du générateur utilisé pour le réservoir
+    unsigned long long state;
 } StatSample;
 
 void init_stat(StatSample *s);
 
+void init_stat_streaming(StatSample *s, size_t reservoir);
+
 void free_stat(StatSample *s);
 
 void update_stat(int n, StatSample *s);
 
+// fusionne from dans into (formules parallèles de Chan), from est laissé tel quel ;
+// en STAT_STREAMING, le réservoir fusionné reste un tirage uniforme sans remise
+// parmi toutes les valeurs, chaque réservoir fournissant un nombre hypergéométrique de places
+void merge_stat(StatSample *into, const StatSample *from);
+
 double sample_avg(StatSample s);
 
+double sample_variance(const StatSample *s);
+
+double sample_stddev(const StatSample *s);
+
+double sample_skewness(const StatSample *s);
+
+int sample_min(const StatSample *s);
+
+int sample_max(const StatSample *s);
+
+double sample_quantile(const StatSample *s, double q);
+
 #endif //DEV3_STATSAMPLE_H
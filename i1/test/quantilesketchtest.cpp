@@ -0,0 +1,74 @@
+#include "catch2/catch.hpp"
+#include "testdata.hpp"
+
+extern "C" {
+#include "../src/quantilesketch.h"
+}
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST_CASE("sketch_quantile sur 10M valeurs", "[sketch_quantile]") {
+    auto values = testdata::lognormal(10'000'000, 42);
+
+    QuantileSketch sketch;
+    REQUIRE(init_sketch(&sketch, QUANTILESKETCH_DEFAULT_K));
+    for (double value : values) {
+        update_sketch(value, &sketch);
+    }
+    REQUIRE(sketch.count == values.size());
+    REQUIRE(sketch_retained(&sketch) < 4 * QUANTILESKETCH_DEFAULT_K);
+
+    std::sort(values.begin(), values.end());
+    double epsilon = sketch_rank_error(QUANTILESKETCH_DEFAULT_K);
+    for (double q : testdata::quantiles) {
+        double estimate = sketch_quantile(&sketch, q);
+        REQUIRE(testdata::rank_error(values, estimate, q) <= epsilon);
+        REQUIRE(std::abs(sketch_rank(&sketch, estimate) - q) <= epsilon);
+    }
+    REQUIRE(sketch_quantile(&sketch, 0.) == values.front());
+    REQUIRE(sketch_quantile(&sketch, 1.) == values.back());
+
+    free_sketch(&sketch);
+}
+
+TEST_CASE("merge_sketch sur 10M valeurs", "[merge_sketch]") {
+    auto values = testdata::lognormal(10'000'000, 7);
+    std::size_t parts = 8;
+    std::size_t step = values.size() / parts;
+
+    QuantileSketch merged;
+    REQUIRE(init_sketch(&merged, QUANTILESKETCH_DEFAULT_K));
+    for (std::size_t p = 0; p < parts; ++p) {
+        QuantileSketch part;
+        REQUIRE(init_sketch(&part, QUANTILESKETCH_DEFAULT_K));
+        for (std::size_t i = p * step; i < (p + 1) * step; ++i) {
+            update_sketch(values[i], &part);
+        }
+        REQUIRE(merge_sketch(&merged, &part));
+        free_sketch(&part);
+    }
+    REQUIRE(merged.count == values.size());
+
+    std::sort(values.begin(), values.end());
+    double epsilon = sketch_rank_error(QUANTILESKETCH_DEFAULT_K);
+    for (double q : testdata::quantiles) {
+        REQUIRE(testdata::rank_error(values, sketch_quantile(&merged, q), q) <= epsilon);
+    }
+
+    free_sketch(&merged);
+}
+
+TEST_CASE("sketch_quantile exact tant que rien n'est compacté", "[sketch_quantile]") {
+    QuantileSketch sketch;
+    REQUIRE(init_sketch(&sketch, QUANTILESKETCH_DEFAULT_K));
+    for (int i = 100; i >= 1; --i) {
+        update_sketch(i, &sketch);
+    }
+    REQUIRE(sketch_quantile(&sketch, .5) == 50.);
+    REQUIRE(sketch_quantile(&sketch, .99) == 99.);
+    REQUIRE(sketch_rank(&sketch, 25.) == Approx(.25));
+
+    free_sketch(&sketch);
+}
@@ -0,0 +1,150 @@
+#include "catch2/catch.hpp"
+#include "testdata.hpp"
+
+extern "C" {
+#include "../src/statreduce.h"
+#include "../src/statsample.h"
+}
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+void init(StatSample *s, StatMode mode) {
+    if (mode == STAT_STREAMING) {
+        init_stat_streaming(s, 1024);
+    } else {
+        init_stat(s);
+    }
+}
+
+void require_same_moments(const StatSample &actual, const StatSample &expected) {
+    REQUIRE(actual.count == expected.count);
+    REQUIRE(actual.sum == expected.sum);
+    REQUIRE(actual.mean == Approx(expected.mean));
+    REQUIRE(actual.m2 == Approx(expected.m2));
+    REQUIRE(actual.m3 == Approx(expected.m3));
+    REQUIRE(actual.min == expected.min);
+    REQUIRE(actual.max == expected.max);
+}
+
+std::vector<int> sorted_data(const StatSample &s) {
+    std::vector<int> values(s.data, s.data + s.length);
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+}
+
+TEST_CASE("merge_stat sur des tranches donne les moments du calcul séquentiel", "[merge_stat]") {
+    auto values = testdata::skewed(200'003, 11);
+
+    for (StatMode mode : {STAT_STORE_ALL, STAT_STREAMING}) {
+        StatSample serial;
+        init(&serial, mode);
+        for (int value : values) {
+            update_stat(value, &serial);
+        }
+
+        // tranches de tailles inégales, dont une vide
+        const std::size_t bounds[] = {0, 17, 17, 50'000, 120'000, 199'999, values.size()};
+        StatSample merged;
+        init(&merged, mode);
+        for (std::size_t p = 0; p + 1 < std::size(bounds); ++p) {
+            StatSample part;
+            init(&part, mode);
+            for (std::size_t i = bounds[p]; i < bounds[p + 1]; ++i) {
+                update_stat(values[i], &part);
+            }
+            merge_stat(&merged, &part);
+            free_stat(&part);
+        }
+
+        require_same_moments(merged, serial);
+        REQUIRE(merged.length == serial.length);
+        if (mode == STAT_STORE_ALL) {
+            REQUIRE(sorted_data(merged) == sorted_data(serial));
+        }
+
+        free_stat(&serial);
+        free_stat(&merged);
+    }
+}
+
+TEST_CASE("stat_parallel_reduce donne les moments du calcul séquentiel", "[stat_parallel_reduce]") {
+    auto values = testdata::skewed(100'000, 23);
+
+    for (StatMode mode : {STAT_STORE_ALL, STAT_STREAMING}) {
+        StatSample serial;
+        init(&serial, mode);
+        for (int value : values) {
+            update_stat(value, &serial);
+        }
+
+        for (unsigned threads : {1u, 2u, 3u, 8u}) {
+            StatSample reduced;
+            init(&reduced, mode);
+            stat_parallel_reduce(values.data(), values.size(), threads, &reduced);
+
+            require_same_moments(reduced, serial);
+            REQUIRE(reduced.length == serial.length);
+            if (mode == STAT_STORE_ALL) {
+                REQUIRE(sorted_data(reduced) == sorted_data(serial));
+            }
+            free_stat(&reduced);
+        }
+
+        free_stat(&serial);
+    }
+}
+
+TEST_CASE("merge_stat tire le réservoir au prorata des effectifs", "[merge_stat]") {
+    // 1000 zéros et 9000 uns : un tirage de 1000 valeurs sans remise
+    // contient en moyenne 100 zéros
+    const int trials = 200;
+    double zeros = 0.;
+    for (int trial = 0; trial < trials; ++trial) {
+        StatSample a;
+        StatSample b;
+        init_stat_streaming(&a, 1000);
+        init_stat_streaming(&b, 1000);
+        a.state += static_cast<unsigned long long>(trial);
+        b.state += static_cast<unsigned long long>(trial) << 20;
+        for (int i = 0; i < 1000; ++i) {
+            update_stat(0, &a);
+        }
+        for (int i = 0; i < 9000; ++i) {
+            update_stat(1, &b);
+        }
+
+        merge_stat(&a, &b);
+        REQUIRE(a.length == 1000);
+        auto values = sorted_data(a);
+        zeros += static_cast<double>(std::count(values.begin(), values.end(), 0));
+
+        free_stat(&a);
+        free_stat(&b);
+    }
+    REQUIRE(zeros / trials == Approx(100.).margin(3.));
+}
+
+TEST_CASE("merge_stat concatène les réservoirs qui tiennent ensemble", "[merge_stat]") {
+    StatSample a;
+    StatSample b;
+    init_stat_streaming(&a, 10);
+    init_stat_streaming(&b, 10);
+    for (int i = 0; i < 4; ++i) {
+        update_stat(i, &a);
+        update_stat(10 + i, &b);
+    }
+
+    merge_stat(&a, &b);
+    REQUIRE(sorted_data(a) == std::vector<int>{0, 1, 2, 3, 10, 11, 12, 13});
+    REQUIRE(sorted_data(b) == std::vector<int>{10, 11, 12, 13});
+    REQUIRE(sample_quantile(&a, 1.) == 13.);
+
+    free_stat(&a);
+    free_stat(&b);
+}
@@ -0,0 +1,118 @@
+#include "catch2/catch.hpp"
+#include "testdata.hpp"
+
+extern "C" {
+#include "../src/statsample.h"
+}
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+/*
+ * Borne de Dvoretzky–Kiefer–Wolfowitz sur l'erreur de rang d'un
+ * échantillon uniforme de k valeurs, dépassée avec une probabilité
+ * inférieure à 1e-9.
+ */
+double reservoir_rank_error(std::size_t k) {
+    return std::sqrt(std::log(2. / 1e-9) / (2. * static_cast<double>(k)));
+}
+
+}
+
+TEST_CASE("STAT_STREAMING donne les moments de STAT_STORE_ALL", "[update_stat]") {
+    auto values = testdata::skewed(1'000'000, 42);
+
+    StatSample all;
+    StatSample streaming;
+    init_stat(&all);
+    init_stat_streaming(&streaming, 4096);
+    for (int value : values) {
+        update_stat(value, &all);
+        update_stat(value, &streaming);
+    }
+
+    REQUIRE(streaming.count == values.size());
+    REQUIRE(streaming.sum == all.sum);
+    REQUIRE(streaming.length == 4096);
+    REQUIRE(all.length == values.size());
+
+    REQUIRE(sample_avg(streaming) == Approx(sample_avg(all)));
+    REQUIRE(sample_variance(&streaming) == Approx(sample_variance(&all)));
+    REQUIRE(sample_stddev(&streaming) == Approx(sample_stddev(&all)));
+    REQUIRE(sample_skewness(&streaming) == Approx(sample_skewness(&all)));
+    REQUIRE(sample_min(&streaming) == sample_min(&all));
+    REQUIRE(sample_max(&streaming) == sample_max(&all));
+
+    // moments recalculés à deux passes sur les valeurs conservées
+    double mean = 0.;
+    for (int value : values) {
+        mean += value;
+    }
+    mean /= static_cast<double>(values.size());
+    double m2 = 0.;
+    double m3 = 0.;
+    for (int value : values) {
+        double delta = value - mean;
+        m2 += delta * delta;
+        m3 += delta * delta * delta;
+    }
+    double n = static_cast<double>(values.size());
+    REQUIRE(sample_variance(&all) == Approx(m2 / (n - 1)));
+    REQUIRE(sample_skewness(&all) == Approx(std::sqrt(n) * m3 / std::pow(m2, 1.5)));
+    REQUIRE(sample_skewness(&all) > 1.);
+
+    std::sort(values.begin(), values.end());
+    double epsilon = reservoir_rank_error(streaming.capacity);
+    for (double q : testdata::quantiles) {
+        REQUIRE(testdata::rank_error(values, sample_quantile(&all, q), q) <= 1. / n);
+        REQUIRE(testdata::rank_error(values, sample_quantile(&streaming, q), q) <= epsilon);
+    }
+
+    free_stat(&all);
+    free_stat(&streaming);
+}
+
+TEST_CASE("STAT_STREAMING est exact tant que le réservoir n'est pas plein", "[update_stat]") {
+    StatSample all;
+    StatSample streaming;
+    init_stat(&all);
+    init_stat_streaming(&streaming, 100);
+    for (int i = 100; i >= 1; --i) {
+        update_stat(i * i, &all);
+        update_stat(i * i, &streaming);
+    }
+
+    REQUIRE(streaming.length == 100);
+    for (double q : testdata::quantiles) {
+        REQUIRE(sample_quantile(&streaming, q) == sample_quantile(&all, q));
+    }
+    REQUIRE(sample_quantile(&streaming, 0.) == 1.);
+    REQUIRE(sample_quantile(&streaming, 1.) == 10000.);
+    REQUIRE(sample_min(&streaming) == 1);
+    REQUIRE(sample_max(&streaming) == 10000);
+
+    free_stat(&all);
+    free_stat(&streaming);
+}
+
+TEST_CASE("STAT_STREAMING sans réservoir garde les moments", "[update_stat]") {
+    StatSample streaming;
+    init_stat_streaming(&streaming, 0);
+    update_stat(-5, &streaming);
+    REQUIRE(sample_variance(&streaming) == 0.);
+    REQUIRE(sample_skewness(&streaming) == 0.);
+    update_stat(5, &streaming);
+    update_stat(30, &streaming);
+
+    REQUIRE(streaming.length == 0);
+    REQUIRE(streaming.count == 3);
+    REQUIRE(sample_avg(streaming) == Approx(10.));
+    REQUIRE(sample_variance(&streaming) == Approx(325.));
+    REQUIRE(sample_min(&streaming) == -5);
+    REQUIRE(sample_max(&streaming) == 30);
+
+    free_stat(&streaming);
+}
@@ -0,0 +1,61 @@
+#ifndef DEV3_TESTDATA_HPP
+#define DEV3_TESTDATA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace testdata {
+
+/*
+ * Quantiles vérifiés par les tests.
+ */
+const double quantiles[] = {.01, .1, .25, .5, .75, .9, .99};
+
+/*
+ * Distance, rapportée au nombre de valeurs, entre q * n et
+ * l'intervalle des rangs exacts de value dans sorted.
+ */
+template<typename T>
+double rank_error(const std::vector<T> &sorted, double value, double q) {
+    double n = static_cast<double>(sorted.size());
+    double lower = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+    double upper = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+    double target = q * n;
+
+    if (target < lower) {
+        return (lower - target) / n;
+    }
+    if (target > upper) {
+        return (target - upper) / n;
+    }
+    return 0.;
+}
+
+/*
+ * Valeurs réelles positives de loi log-normale.
+ */
+inline std::vector<double> lognormal(std::size_t size, unsigned seed) {
+    std::mt19937_64 generator{seed};
+    std::lognormal_distribution<double> distribution{0., 1.};
+    std::vector<double> values(size);
+    std::generate(values.begin(), values.end(), [&]() { return distribution(generator); });
+    return values;
+}
+
+/*
+ * Valeurs entières asymétriques (loi géométrique décalée), pour que
+ * l'asymétrie à comparer ne soit pas nulle.
+ */
+inline std::vector<int> skewed(std::size_t size, unsigned seed) {
+    std::mt19937_64 generator{seed};
+    std::geometric_distribution<int> distribution{.002};
+    std::vector<int> values(size);
+    std::generate(values.begin(), values.end(), [&]() { return distribution(generator) - 300; });
+    return values;
+}
+
+}
+
+#endif //DEV3_TESTDATA_HPP
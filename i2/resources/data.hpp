@@ -11,6 +11,8 @@
 #include <vector>
 #include <tuple>
 
+#include "random/random.hpp"
+
 /*!
  * \brief Espace de nommage de la [HE2B](https://www.he2b.be/).
  *
@@ -67,13 +69,12 @@ enum class Randomness {
  *    différent du nombre d'éléments du std::vector en second index
  *    du std::tuple.
  *
- * _Remarque_ : si le paramètre `reproductible` est mis à
- * Randomness::NON_REPRODUCTIBLE, cela rend non reproductible
- * d'une exécution à l'autre cet appel de fonction,
- * mais également celui de toutes les fonctions avec un argument
- * de type \ref Randomness appelées utlérieurement, car les
- * fonctions de random.hpp utilisent toutes _le même_ générateur
- * aléatoire.
+ * _Remarque_ : la fonction n'utilise pas le générateur partagé de
+ * nvs::urng(). Randomness::REPRODUCTIBLE revient à appeler la
+ * variante avec une graine par défaut (seed{}),
+ * Randomness::NON_REPRODUCTIBLE à l'appeler avec une graine tirée
+ * de nvs::random_seed(). L'un n'influence donc plus l'autre, même
+ * depuis plusieurs threads.
  *
  * \param size pour contrôler le nombre d'élements du std::vector
  *             retourné.
@@ -86,6 +87,23 @@ std::vector<std::tuple<std::string, std::vector<double>>>
 data(std::size_t size = 1'000'000,
      Randomness reproductible = Randomness::NON_REPRODUCTIBLE);
 
+/*!
+ * \brief Fonction de production de données à partir d'une graine.
+ *
+ * Produit les mêmes données que la variante avec un argument de type
+ * \ref Randomness, mais tirées d'un générateur propre à l'appel,
+ * déterminé par `s`. Deux appels avec la même graine retournent les
+ * mêmes données, quels que soient les autres threads.
+ *
+ * \param size pour contrôler le nombre d'élements du std::vector
+ *             retourné.
+ * \param s graine et numéro de flux.
+ *
+ * \return données brutes telles que décrites pour l'autre variante.
+ */
+std::vector<std::tuple<std::string, std::vector<double>>>
+data(std::size_t size, const seed &s);
+
 } // namespace he2b::nvs
 
 } // namespace he2b
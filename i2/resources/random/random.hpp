@@ -7,9 +7,18 @@
 #ifndef RANDOM_HPP
 #define RANDOM_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
 #include <random>
+#include <stdexcept>
 #include <utility>
 #include <limits>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
 #ifdef _WIN32
 #include <ctime>
 #endif
@@ -26,6 +35,378 @@ namespace he2b {
  */
 namespace nvs {
 
+// générateurs
+
+/*!
+ * \brief Générateur Philox4x32-10, basé sur un compteur.
+ *
+ * Chaque bloc de quatre entiers de 32 bits est obtenu en chiffrant
+ * un compteur de 128 bits par dix tours d'une permutation pseudo-
+ * aléatoire paramétrée par une clé de 64 bits. Il est issu de
+ * Parallel Random Numbers: As Easy as 1, 2, 3
+ * ([SC11](http://www.thesalmons.org/john/random123/papers/random123sc11.pdf)),
+ * par John K. Salmon et al.
+ *
+ * La clé est la graine. Les 64 bits de poids fort du compteur
+ * identifient un _flux_ (_stream_), les 64 bits de poids faible la
+ * position dans ce flux. Deux générateurs de même graine et de flux
+ * différents produisent donc des séquences indépendantes, sans état
+ * partagé ni verrou : il suffit d'en donner un par thread, par
+ * exemple avec le numéro du thread comme flux. Le générateur est
+ * reproductible et philox4x32::discard avance en temps constant.
+ *
+ * Le générateur satisfait les exigences d'un
+ * _UniformRandomBitGenerator_ et s'utilise donc avec toutes les
+ * distributions de la bibliothèque standard.
+ */
+class philox4x32 {
+ public:
+  /*!
+   * \brief Type des valeurs produites.
+   */
+  using result_type = std::uint32_t;
+
+  /*!
+   * \brief Graine utilisée par le constructeur par défaut.
+   */
+  static constexpr std::uint64_t default_seed = 20111115u;
+
+  /*!
+   * \brief Constructeur.
+   *
+   * \param seed graine, c'est-à-dire la clé de chiffrement.
+   * \param stream numéro du flux.
+   */
+  explicit philox4x32(std::uint64_t seed = default_seed,
+                      std::uint64_t stream = 0) {
+    this->seed(seed, stream);
+  }
+
+  /*!
+   * \brief Replace le générateur au début d'un flux.
+   *
+   * \param seed graine, c'est-à-dire la clé de chiffrement.
+   * \param stream numéro du flux.
+   */
+  void seed(std::uint64_t seed, std::uint64_t stream = 0) {
+    key_ = {static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)};
+    stream_ = stream;
+    position_ = 0;
+    index_ = 4;
+  }
+
+  /*!
+   * \brief Plus petite valeur produite.
+   *
+   * \return 0.
+   */
+  static constexpr result_type min() {
+    return 0;
+  }
+
+  /*!
+   * \brief Plus grande valeur produite.
+   *
+   * \return 2^32 - 1.
+   */
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /*!
+   * \brief Produit la valeur suivante du flux.
+   *
+   * \return un entier uniformément réparti sur 32 bits.
+   */
+  result_type operator()() {
+    if (index_ == 4) {
+      block_ = block(counter(position_, stream_), key_);
+      ++position_;
+      index_ = 0;
+    }
+
+    return block_[index_++];
+  }
+
+  /*!
+   * \brief Saute `n` valeurs du flux, en temps constant.
+   *
+   * \param n nombre de valeurs à passer.
+   */
+  void discard(unsigned long long n) {
+    // rang absolu de la prochaine valeur dans le flux
+    unsigned long long next = 4 * position_ - (4 - index_) + n;
+
+    position_ = next / 4;
+    index_ = 4;
+    if (next % 4 != 0) {
+      block_ = block(counter(position_, stream_), key_);
+      ++position_;
+      index_ = static_cast<unsigned>(next % 4);
+    }
+  }
+
+  /*!
+   * \brief Générateur de même graine sur un autre flux.
+   *
+   * \param stream numéro du flux.
+   *
+   * \return un générateur au début du flux `stream`.
+   */
+  philox4x32 split(std::uint64_t stream) const {
+    philox4x32 other{*this};
+    other.seed(seed(), stream);
+
+    return other;
+  }
+
+  /*!
+   * \brief Accesseur en lecture de la graine.
+   *
+   * \return la graine.
+   */
+  std::uint64_t seed() const {
+    return static_cast<std::uint64_t>(key_[1]) << 32 | key_[0];
+  }
+
+  /*!
+   * \brief Accesseur en lecture du numéro de flux.
+   *
+   * \return le numéro de flux.
+   */
+  std::uint64_t stream() const {
+    return stream_;
+  }
+
+  /*!
+   * \brief Chiffre un compteur.
+   *
+   * C'est la fonction Philox4x32-10 proprement dite : le bloc
+   * retourné ne dépend que de `counter` et de `key`.
+   *
+   * \param counter compteur de 128 bits, mot de poids faible en
+   *                premier.
+   * \param key clé de 64 bits, mot de poids faible en premier.
+   *
+   * \return le bloc chiffré.
+   */
+  static std::array<std::uint32_t, 4>
+  block(std::array<std::uint32_t, 4> counter,
+        std::array<std::uint32_t, 2> key) {
+    for (unsigned round = 0; round < 10; ++round) {
+      std::uint64_t product0 = std::uint64_t{0xD2511F53} * counter[0];
+      std::uint64_t product1 = std::uint64_t{0xCD9E8D57} * counter[2];
+
+      counter = {
+          static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+          static_cast<std::uint32_t>(product1),
+          static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+          static_cast<std::uint32_t>(product0)};
+
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+
+    return counter;
+  }
+
+  /*!
+   * \brief Comparaison.
+   *
+   * Deux générateurs sont égaux s'ils produiront la même suite de
+   * valeurs.
+   */
+  friend bool operator==(const philox4x32 &lhs, const philox4x32 &rhs) {
+    return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_
+           && 4 * lhs.position_ - (4 - lhs.index_)
+              == 4 * rhs.position_ - (4 - rhs.index_);
+  }
+
+  friend bool operator!=(const philox4x32 &lhs, const philox4x32 &rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  static std::array<std::uint32_t, 4> counter(std::uint64_t position,
+                                              std::uint64_t stream) {
+    return {static_cast<std::uint32_t>(position),
+            static_cast<std::uint32_t>(position >> 32),
+            static_cast<std::uint32_t>(stream),
+            static_cast<std::uint32_t>(stream >> 32)};
+  }
+
+  std::array<std::uint32_t, 2> key_;
+  std::uint64_t stream_;
+  std::uint64_t position_;
+  std::array<std::uint32_t, 4> block_{};
+  unsigned index_;
+};
+
+/*!
+ * \brief Générateur xoshiro256++.
+ *
+ * Générateur rapide de 64 bits par appel, d'état de 256 bits et de
+ * période 2^256 - 1. Il est issu de Scrambled Linear Pseudorandom
+ * Number Generators ([ACM TOMS 47-4](https://prng.di.unimi.it/)),
+ * par David Blackman et Sebastiano Vigna.
+ *
+ * L'état est initialisé à partir d'une graine de 64 bits par
+ * splitmix64, comme le recommandent les auteurs. xoshiro256pp::jump
+ * avance de 2^128 valeurs, ce qui fournit jusqu'à 2^128 séquences
+ * disjointes à partir d'une même graine.
+ *
+ * C'est le générateur utilisé par défaut par nvs::fill_uniform.
+ */
+class xoshiro256pp {
+ public:
+  /*!
+   * \brief Type des valeurs produites.
+   */
+  using result_type = std::uint64_t;
+
+  /*!
+   * \brief Constructeur.
+   *
+   * \param seed graine.
+   */
+  explicit xoshiro256pp(std::uint64_t seed = 0x853C49E6748FEA9Bu) {
+    this->seed(seed);
+  }
+
+  /*!
+   * \brief Remet le générateur dans l'état issu de `seed`.
+   *
+   * \param seed graine.
+   */
+  void seed(std::uint64_t seed) {
+    for (auto &word : state_) {
+      // splitmix64
+      std::uint64_t z = (seed += 0x9E3779B97F4A7C15u);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+      word = z ^ (z >> 31);
+    }
+  }
+
+  /*!
+   * \brief Plus petite valeur produite.
+   *
+   * \return 0.
+   */
+  static constexpr result_type min() {
+    return 0;
+  }
+
+  /*!
+   * \brief Plus grande valeur produite.
+   *
+   * \return 2^64 - 1.
+   */
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /*!
+   * \brief Produit la valeur suivante.
+   *
+   * \return un entier uniformément réparti sur 64 bits.
+   */
+  result_type operator()() {
+    const std::uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+    const std::uint64_t t = state_[1] << 17;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+
+    return result;
+  }
+
+  /*!
+   * \brief Saute `n` valeurs.
+   *
+   * \param n nombre de valeurs à passer.
+   */
+  void discard(unsigned long long n) {
+    for (; n != 0; --n) {
+      (*this)();
+    }
+  }
+
+  /*!
+   * \brief Avance de 2^128 valeurs.
+   *
+   * Appelé k fois sur des copies d'un même générateur, il donne
+   * k séquences qui ne se recouvrent pas.
+   */
+  void jump() {
+    static constexpr std::uint64_t polynomial[] = {
+        0x180EC6D33CFD0ABAu, 0xD5A61266F0C9392Cu,
+        0xA9582618E03FC9AAu, 0x39ABDC4529B1661Cu};
+    std::array<std::uint64_t, 4> state{};
+
+    for (auto word : polynomial) {
+      for (unsigned bit = 0; bit < 64; ++bit) {
+        if (word & std::uint64_t{1} << bit) {
+          for (unsigned i = 0; i < 4; ++i) {
+            state[i] ^= state_[i];
+          }
+        }
+        (*this)();
+      }
+    }
+
+    state_ = state;
+  }
+
+  /*!
+   * \brief Comparaison.
+   *
+   * Deux générateurs sont égaux s'ils produiront la même suite de
+   * valeurs.
+   */
+  friend bool operator==(const xoshiro256pp &lhs, const xoshiro256pp &rhs) {
+    return lhs.state_ == rhs.state_;
+  }
+
+  friend bool operator!=(const xoshiro256pp &lhs, const xoshiro256pp &rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  static std::uint64_t rotl(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::array<std::uint64_t, 4> state_;
+};
+
+/*!
+ * \brief Graine explicite : valeur et numéro de flux.
+ *
+ * Passée à nvs::urng(const seed &) ou aux fonctions de génération
+ * de données, elle fixe complètement la suite produite, sans
+ * passer par le générateur partagé de nvs::urng(). Le résultat est
+ * donc le même quels que soient le nombre de threads et leur
+ * ordonnancement. Deux graines de même valeur et de flux différents
+ * donnent des suites indépendantes : un flux par tâche.
+ */
+struct seed {
+  /*!
+   * \brief Valeur de la graine.
+   */
+  std::uint64_t value = philox4x32::default_seed;
+
+  /*!
+   * \brief Numéro du flux.
+   */
+  std::uint64_t stream = 0;
+};
+
 // fonctions
 
 /*!
@@ -82,6 +463,83 @@ inline void randomize() {
 #endif
 }
 
+/*!
+ * \brief Un générateur propre au thread appelant.
+ *
+ * Contrairement à nvs::urng(), partagé par tous et donc à ne pas
+ * utiliser depuis plusieurs threads, chaque thread reçoit ici son
+ * propre nvs::philox4x32. Tous partagent une graine tirée une fois
+ * pour toutes d'un std::random_device et chacun reçoit un numéro de
+ * flux distinct, dans l'ordre de leur premier appel. Aucun verrou
+ * n'est pris après ce premier appel.
+ *
+ * Pour des résultats reproductibles quel que soit l'ordonnancement,
+ * construire plutôt un nvs::philox4x32 par tâche avec une graine et
+ * un numéro de flux explicites.
+ *
+ * \return le générateur du thread appelant.
+ */
+inline philox4x32 &thread_urng() {
+  static const std::uint64_t seed = [] {
+    std::random_device rd{};
+    return static_cast<std::uint64_t>(rd()) << 32 | rd();
+  }();
+  static std::atomic<std::uint64_t> streams{0};
+  thread_local philox4x32 u{seed, streams++};
+
+  return u;
+}
+
+/*!
+ * \brief Un générateur rapide propre au thread appelant.
+ *
+ * Chaque thread reçoit son propre nvs::xoshiro256pp, initialisé
+ * à partir de nvs::thread_urng(). C'est le générateur utilisé par
+ * nvs::fill_uniform quand aucun générateur n'est fourni.
+ *
+ * \return le générateur rapide du thread appelant.
+ */
+inline xoshiro256pp &fast_urng() {
+  thread_local xoshiro256pp u{[] {
+    auto &seeder = thread_urng();
+    return static_cast<std::uint64_t>(seeder()) << 32 | seeder();
+  }()};
+
+  return u;
+}
+
+/*!
+ * \brief Un générateur déterminé par une graine explicite.
+ *
+ * Contrairement à nvs::urng(), le générateur retourné n'est
+ * partagé avec personne : deux appels avec la même graine donnent
+ * deux générateurs qui produisent la même suite.
+ *
+ * \param s graine et numéro de flux.
+ *
+ * \return un nvs::philox4x32 au début du flux `s.stream`.
+ */
+inline philox4x32 urng(const seed &s) {
+  return philox4x32{s.value, s.stream};
+}
+
+/*!
+ * \brief Une graine aléatoire.
+ *
+ * La valeur est tirée d'un std::random_device, pour un comportement
+ * non reproductible d'une exécution à l'autre.
+ *
+ * \param stream numéro du flux.
+ *
+ * \return une graine de valeur aléatoire.
+ */
+inline seed random_seed(std::uint64_t stream = 0) {
+  std::random_device rd{};
+  std::uint64_t high = rd();
+
+  return seed{high << 32 | rd(), stream};
+}
+
 /*!
  * \brief Générateur de flottants aléatoires.
  *
@@ -155,6 +613,415 @@ inline T random_value(T min = std::numeric_limits<T>::min(),
   return d(urng(), typename decltype(d)::param_type{min, max});
 }
 
+/*!
+ * \brief Générateur de nombres aléatoires avec un générateur
+ *        explicite.
+ *
+ * Variante de nvs::random_value qui tire de `engine` plutôt que du
+ * générateur partagé de nvs::urng(). Les entiers sont tirés entre
+ * `min` et `max` compris, les flottants dans l'intervalle
+ * semi-ouvert [`min`, `max`[. Si `max` est strictement inférieur à
+ * `min`, les contenus de ces variables sont permutés.
+ *
+ * \param min valeur minimale (ou maximale).
+ * \param max valeur maximale (ou minimale).
+ * \param engine générateur à utiliser, par exemple celui retourné
+ *               par nvs::urng(const seed &).
+ *
+ * \return une valeur entre `min` et `max`.
+ */
+template<typename T, typename Engine>
+inline T random_value(T min, T max, Engine &engine) {
+  if (max < min) std::swap(min, max);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::uniform_real_distribution<T>{min, max}(engine);
+  } else {
+    return std::uniform_int_distribution<T>{min, max}(engine);
+  }
+}
+
+
+namespace detail {
+
+/*!
+ * \brief 64 bits aléatoires tirés de `engine`.
+ *
+ * Le générateur doit produire tous les entiers de 32 ou de 64 bits.
+ */
+template<typename Engine>
+inline std::uint64_t bits64(Engine &engine) {
+  static_assert(Engine::min() == 0, "générateur non supporté");
+
+  if constexpr (Engine::max() == std::numeric_limits<std::uint64_t>::max()) {
+    return engine();
+  } else {
+    static_assert(Engine::max() == std::numeric_limits<std::uint32_t>::max(),
+                  "générateur non supporté");
+    std::uint64_t high = engine();
+    return high << 32 | engine();
+  }
+}
+
+/*!
+ * \brief Produit de deux entiers de 64 bits sur 128 bits.
+ *
+ * \param low reçoit les 64 bits de poids faible.
+ *
+ * \return les 64 bits de poids fort.
+ */
+inline std::uint64_t multiply(std::uint64_t lhs, std::uint64_t rhs,
+                              std::uint64_t &low) {
+#ifdef __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 uint128;
+  uint128 product = static_cast<uint128>(lhs) * rhs;
+  low = static_cast<std::uint64_t>(product);
+  return static_cast<std::uint64_t>(product >> 64);
+#else
+  std::uint64_t lhs_low = lhs & 0xFFFFFFFFu, lhs_high = lhs >> 32;
+  std::uint64_t rhs_low = rhs & 0xFFFFFFFFu, rhs_high = rhs >> 32;
+  std::uint64_t low_low = lhs_low * rhs_low;
+  std::uint64_t middle = (low_low >> 32) + (lhs_high * rhs_low & 0xFFFFFFFFu)
+                         + lhs_low * rhs_high;
+  low = lhs * rhs;
+  return lhs_high * rhs_high + (lhs_high * rhs_low >> 32) + (middle >> 32);
+#endif
+}
+
+/*!
+ * \brief Entier uniforme de [0, `range`] par la méthode de Lemire.
+ *
+ * Un seul tirage de 32 bits suffit quand `range` tient sur 32 bits
+ * et que le générateur produit 32 bits par appel. Les générateurs
+ * qui ne produisent pas tous les entiers de 32 ou 64 bits, comme
+ * celui de nvs::urng(), passent par std::uniform_int_distribution.
+ */
+template<typename Engine>
+inline std::uint64_t bounded(std::uint64_t range, Engine &engine) {
+  constexpr bool full32 =
+      Engine::min() == 0
+      && Engine::max() == std::numeric_limits<std::uint32_t>::max();
+  constexpr bool full64 =
+      Engine::min() == 0
+      && Engine::max() == std::numeric_limits<std::uint64_t>::max();
+
+  if constexpr (!full32 && !full64) {
+    return std::uniform_int_distribution<std::uint64_t>{0, range}(engine);
+  } else {
+    if (full32 && range < std::numeric_limits<std::uint32_t>::max()) {
+      const std::uint64_t bound = range + 1;
+      std::uint64_t product = static_cast<std::uint32_t>(engine()) * bound;
+      if (static_cast<std::uint32_t>(product) < bound) {
+        const std::uint32_t threshold = static_cast<std::uint32_t>(
+            (std::uint64_t{1} << 32) % bound);
+        while (static_cast<std::uint32_t>(product) < threshold) {
+          product = static_cast<std::uint32_t>(engine()) * bound;
+        }
+      }
+      return product >> 32;
+    }
+
+    if (range == std::numeric_limits<std::uint64_t>::max()) {
+      return bits64(engine);
+    }
+
+    const std::uint64_t bound = range + 1;
+    std::uint64_t low;
+    std::uint64_t high = multiply(bits64(engine), bound, low);
+    if (low < bound) {
+      const std::uint64_t threshold = (0 - bound) % bound;
+      while (low < threshold) {
+        high = multiply(bits64(engine), bound, low);
+      }
+    }
+
+    return high;
+  }
+}
+
+/*!
+ * \brief Nombre de bits nuls de poids faible d'un mot non nul.
+ */
+inline unsigned countr_zero(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+  unsigned result = 0;
+  for (; !(word & 1); word >>= 1) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+} // namespace detail
+
+/*!
+ * \brief Remplissage rapide par des entiers ou des flottants
+ *        aléatoires.
+ *
+ * Remplit l'intervalle [`first`, `last`[ de valeurs uniformément
+ * réparties entre `min` et `max`. Comme pour nvs::random_value, les
+ * entiers sont tirés dans l'intervalle fermé [`min`, `max`] et les
+ * flottants dans l'intervalle semi-ouvert [`min`, `max`[, et les
+ * bornes sont permutées si `max` < `min`.
+ *
+ * Les entiers sont ramenés à l'intervalle par la méthode de Lemire
+ * (Fast Random Integer Generation in an Interval,
+ * [ACM TOMS 29-1](https://arxiv.org/abs/1805.10941)) : une
+ * multiplication et, sauf rarement, aucune division. Quand l'intervalle
+ * tient sur 32 bits, chaque valeur de 64 bits du générateur fournit
+ * deux entiers. Les flottants sont obtenus à partir des 53 bits de
+ * poids fort, sans branche, ce qui laisse au compilateur la
+ * possibilité de vectoriser la conversion.
+ *
+ * Contrairement à nvs::random_value, aucune distribution n'est
+ * construite par valeur : c'est la fonction à utiliser pour remplir
+ * de grands tableaux.
+ *
+ * \param first début de l'intervalle à remplir.
+ * \param last fin de l'intervalle à remplir.
+ * \param min valeur minimale (ou maximale).
+ * \param max valeur maximale (ou minimale).
+ * \param engine générateur produisant tous les entiers de 32 ou
+ *               64 bits, par exemple nvs::xoshiro256pp ou
+ *               nvs::philox4x32.
+ */
+template<typename It, typename Engine>
+void fill_uniform(It first, It last,
+                  typename std::iterator_traits<It>::value_type min,
+                  typename std::iterator_traits<It>::value_type max,
+                  Engine &engine) {
+  using T = typename std::iterator_traits<It>::value_type;
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                "type non supporté");
+
+  if (max < min) std::swap(min, max);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    const T width = max - min;
+    for (; first != last; ++first) {
+      T unit = static_cast<T>(detail::bits64(engine) >> 11) * T(0x1.0p-53);
+      T value = min + unit * width;
+      // un arrondi peut atteindre max, exclu de l'intervalle
+      *first = value < max ? value : min;
+    }
+  } else {
+    using U = std::make_unsigned_t<T>;
+    const std::uint64_t range
+        {static_cast<U>(static_cast<U>(max) - static_cast<U>(min))};
+    const U base = static_cast<U>(min);
+
+    if (range <= std::numeric_limits<std::uint32_t>::max()) {
+      const std::uint64_t bound = range + 1;
+      const std::uint32_t threshold = static_cast<std::uint32_t>(
+          (std::uint64_t{1} << 32) % bound);
+      std::uint64_t pending = 0;
+      bool available = false;
+
+      while (first != last) {
+        std::uint32_t x;
+        if (available) {
+          x = static_cast<std::uint32_t>(pending >> 32);
+        } else {
+          pending = detail::bits64(engine);
+          x = static_cast<std::uint32_t>(pending);
+        }
+        available = !available;
+
+        std::uint64_t product = x * bound;
+        if (static_cast<std::uint32_t>(product) < threshold) {
+          continue;
+        }
+        *first = static_cast<T>(static_cast<U>(base + (product >> 32)));
+        ++first;
+      }
+    } else if (range == std::numeric_limits<std::uint64_t>::max()) {
+      for (; first != last; ++first) {
+        *first = static_cast<T>(detail::bits64(engine));
+      }
+    } else {
+      const std::uint64_t bound = range + 1;
+      const std::uint64_t threshold = (0 - bound) % bound;
+
+      for (; first != last; ++first) {
+        std::uint64_t low;
+        std::uint64_t high;
+        do {
+          high = detail::multiply(detail::bits64(engine), bound, low);
+        } while (low < threshold);
+        *first = static_cast<T>(static_cast<U>(base + high));
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Remplissage rapide avec le générateur du thread appelant.
+ *
+ * Identique à la version à cinq paramètres, avec nvs::fast_urng()
+ * comme générateur.
+ *
+ * \param first début de l'intervalle à remplir.
+ * \param last fin de l'intervalle à remplir.
+ * \param min valeur minimale (ou maximale).
+ * \param max valeur maximale (ou minimale).
+ */
+template<typename It>
+inline void fill_uniform(It first, It last,
+                         typename std::iterator_traits<It>::value_type min,
+                         typename std::iterator_traits<It>::value_type max) {
+  fill_uniform(first, last, min, max, fast_urng());
+}
+
+
+/*!
+ * \brief Tirage sans remise dans un intervalle d'itérateurs.
+ *
+ * Remplit [`first`, `last`[ de valeurs distinctes de [`min`, `max`],
+ * triées par ordre croissant. C'est la variante de
+ * nvs::random_sample qui écrit directement dans un tampon existant,
+ * sans allocation tant que l'échantillon est petit.
+ *
+ * \param first début de l'intervalle à remplir, itérateur à accès
+ *              direct.
+ * \param last fin de l'intervalle à remplir.
+ * \param min valeur minimale (ou maximale) pouvant être tirée.
+ * \param max valeur maximale (ou minimale) pouvant être tirée.
+ * \param engine générateur à utiliser.
+ *
+ * \throw std::invalid_argument si l'intervalle à remplir est plus
+ *        grand que l'intervalle des valeurs.
+ *
+ * \see random_sample(std::size_t, T, T, Engine &)
+ */
+template<typename It, typename Engine>
+void fill_sample(It first, It last,
+                 typename std::iterator_traits<It>::value_type min,
+                 typename std::iterator_traits<It>::value_type max,
+                 Engine &engine) {
+  using T = typename std::iterator_traits<It>::value_type;
+  static_assert(std::is_integral_v<T>, "type non supporté");
+  using U = std::make_unsigned_t<T>;
+
+  if (max < min) std::swap(min, max);
+
+  const auto k = static_cast<std::uint64_t>(last - first);
+  const std::uint64_t range
+      {static_cast<U>(static_cast<U>(max) - static_cast<U>(min))};
+  if (k != 0 && k - 1 > range) {
+    throw std::invalid_argument{"échantillon plus grand que l'intervalle"};
+  }
+
+  auto value = [min](std::uint64_t offset) {
+    return static_cast<T>(static_cast<U>(static_cast<U>(min) + offset));
+  };
+
+  const std::uint64_t begin = range + 1 - k;
+
+  if (range < 256) {
+    // petit intervalle : appartenance par masque de bits, les
+    // valeurs sortent triées en parcourant le masque
+    std::uint64_t mask[4] = {0, 0, 0, 0};
+    for (std::uint64_t j = begin; j <= range; ++j) {
+      std::uint64_t t = detail::bounded(j, engine);
+      if (mask[t >> 6] >> (t & 63) & 1) {
+        t = j;
+      }
+      mask[t >> 6] |= std::uint64_t{1} << (t & 63);
+    }
+    for (unsigned word = 0; word < 4; ++word) {
+      for (std::uint64_t bits = mask[word]; bits != 0; bits &= bits - 1) {
+        *first++ = value(64 * word + detail::countr_zero(bits));
+      }
+    }
+  } else if (k <= 256) {
+    It end = first;
+    for (std::uint64_t j = begin; end != last; ++j) {
+      T candidate = value(detail::bounded(j, engine));
+      It position = std::lower_bound(first, end, candidate);
+      if (position != end && *position == candidate) {
+        // j n'a pas encore été tiré puisque les tirages précédents
+        // sont tous inférieurs à j
+        *end = value(j);
+      } else {
+        std::move_backward(position, end, end + 1);
+        *position = candidate;
+      }
+      ++end;
+    }
+  } else {
+    std::unordered_set<std::uint64_t> chosen;
+    chosen.reserve(k);
+    for (std::uint64_t j = begin; chosen.size() < k; ++j) {
+      std::uint64_t t = detail::bounded(j, engine);
+      chosen.insert(chosen.count(t) ? j : t);
+    }
+    std::transform(chosen.begin(), chosen.end(), first, value);
+    std::sort(first, last);
+  }
+}
+
+/*!
+ * \brief Tirage sans remise de `k` entiers parmi [`min`, `max`].
+ *
+ * Les `k` valeurs sont distinctes et retournées triées par ordre
+ * croissant. Chaque sous-ensemble de taille `k` a la même
+ * probabilité d'être tiré.
+ *
+ * L'algorithme est celui de Robert Floyd (Programming Pearls,
+ * [CACM 30-9](https://dl.acm.org/doi/10.1145/30401.315746)) :
+ * `k` tirages seulement, quelle que soit la taille de
+ * l'intervalle, et une mémoire en O(`k`). Tirer 8 valeurs parmi
+ * 10^9 ne demande donc pas de construire l'intervalle entier.
+ * Sur un intervalle d'au plus 256 valeurs, l'appartenance est testée
+ * dans un masque de bits parcouru ensuite dans l'ordre. Sinon, tant
+ * que `k` est petit, l'échantillon est maintenu trié par insertion ;
+ * au-delà, un std::unordered_set sert aux tests d'appartenance et le
+ * tri est fait à la fin.
+ *
+ * Si `max` est strictement inférieur à `min`, les contenus de ces
+ * variables sont permutés.
+ *
+ * \param k nombre de valeurs à tirer.
+ * \param min valeur minimale (ou maximale) pouvant être tirée.
+ * \param max valeur maximale (ou minimale) pouvant être tirée.
+ * \param engine générateur à utiliser.
+ *
+ * \return les `k` valeurs tirées, triées par ordre croissant.
+ *
+ * \throw std::invalid_argument si `k` dépasse le nombre de valeurs
+ *        de l'intervalle.
+ */
+template<typename T, typename Engine>
+std::vector<T> random_sample(std::size_t k, T min, T max,
+                             Engine &engine) {
+  std::vector<T> result(k);
+  fill_sample(result.begin(), result.end(), min, max, engine);
+
+  return result;
+}
+
+/*!
+ * \brief Tirage sans remise avec le générateur partagé.
+ *
+ * Identique à la version à quatre paramètres, avec nvs::urng()
+ * comme générateur.
+ *
+ * \param k nombre de valeurs à tirer.
+ * \param min valeur minimale (ou maximale) pouvant être tirée.
+ * \param max valeur maximale (ou minimale) pouvant être tirée.
+ *
+ * \return les `k` valeurs tirées, triées par ordre croissant.
+ *
+ * \throw std::invalid_argument si `k` dépasse le nombre de valeurs
+ *        de l'intervalle.
+ */
+template<typename T>
+inline std::vector<T> random_sample(std::size_t k, T min, T max) {
+  return random_sample(k, min, max, urng());
+}
+
 } // namespace he2b::nvs
 
 } // namespace he2b
@@ -11,24 +11,20 @@ PrimeFactorization *PrimeFactorization_new(unsigned int number) {
         return NULL;
     }
 
-    primeFactorization->number = number;
-    primeFactorization->count = 0;
-    primeFactorization->primeFactors = malloc(number * sizeof(PrimeFactor));
-
-    if (primeFactorization->primeFactors == NULL) {
-        free(primeFactorization);
-        return NULL;
-    }
+    PrimeFactorization_init(primeFactorization, number);
 
     return primeFactorization;
 }
 
+void PrimeFactorization_init(PrimeFactorization *primeFactorization, unsigned int number) {
+    assert(primeFactorization != NULL);
+
+    primeFactorization->number = number;
+    primeFactorization->count = 0;
+}
+
 void PrimeFactorization_free(PrimeFactorization *primeFactorization) {
     if (primeFactorization != NULL) {
-        if (primeFactorization->primeFactors != NULL) {
-            free(primeFactorization->primeFactors);
-            primeFactorization->primeFactors = NULL;
-        }
         free(primeFactorization);
         primeFactorization = NULL;
     }
@@ -36,7 +32,6 @@ void PrimeFactorization_free(PrimeFactorization *primeFactorization) {
 
 void PrimeFactorization_print(PrimeFactorization *primeFactorization) {
     assert(primeFactorization != NULL);
-    assert(primeFactorization->primeFactors != NULL);
 
     printf("{%d, %d, ", primeFactorization->number, primeFactorization->count);
     for (int i = 0; i < primeFactorization->count; ++i) {
@@ -49,7 +44,7 @@ void PrimeFactorization_print(PrimeFactorization *primeFactorization) {
 void PrimeFactorization_addPrimeFactor(PrimeFactorization *primeFactorization, unsigned int value,
                                        unsigned int multiplicity) {
     assert(primeFactorization != NULL);
-    assert(primeFactorization->primeFactors != NULL);
+    assert(primeFactorization->count < PRIMEFACTORIZATION_CAPACITY);
     assert(value > 1);
     assert(multiplicity != 0);
 
@@ -58,11 +53,3 @@ void PrimeFactorization_addPrimeFactor(PrimeFactorization *primeFactorization, u
     (primeFactorization->count)++;
 }
 
-void PrimeFactorization_resizePrimeFactorsArray(PrimeFactorization *primeFactorization) {
-    assert(primeFactorization != NULL);
-    assert(primeFactorization->primeFactors != NULL);
-
-    primeFactorization->primeFactors = realloc(primeFactorization->primeFactors,
-                                               primeFactorization->count * sizeof(PrimeFactor));
-}
-
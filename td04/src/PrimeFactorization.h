@@ -6,20 +6,26 @@
 
 #include "PrimeFactor.h"
 
+/**
+ * Nombre maximal de facteurs premiers distincts d'un unsigned :
+ * 2 * 3 * 5 * 7 * 11 * 13 * 17 * 19 * 23 * 29 dépasse déjà 2^32.
+ */
+#define PRIMEFACTORIZATION_CAPACITY 10
+
 typedef struct PrimeFactorization {
     unsigned number;
     unsigned count;
-    PrimeFactor *primeFactors;
+    PrimeFactor primeFactors[PRIMEFACTORIZATION_CAPACITY];
 } PrimeFactorization;
 
 PrimeFactorization *PrimeFactorization_new(unsigned number);
 
+void PrimeFactorization_init(PrimeFactorization *primeFactorization, unsigned number);
+
 void PrimeFactorization_free(PrimeFactorization *primeFactorization);
 
 void PrimeFactorization_print(PrimeFactorization *primeFactorization);
 
 void PrimeFactorization_addPrimeFactor(PrimeFactorization *primeFactorization, unsigned value, unsigned multiplicity);
 
-void PrimeFactorization_resizePrimeFactorsArray(PrimeFactorization *primeFactorization);
-
 #endif //DEV3_PRIMEFACTORIZATION_H
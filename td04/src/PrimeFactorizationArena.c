@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <assert.h>
+#include "PrimeFactorizationArena.h"
+
+PrimeFactorizationArena *PrimeFactorizationArena_new(unsigned int capacity) {
+    PrimeFactorizationArena *arena = malloc(sizeof(PrimeFactorizationArena));
+
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    arena->count = 0;
+    arena->capacity = capacity;
+    arena->primeFactorizations = malloc(capacity * sizeof(PrimeFactorization));
+
+    if (arena->primeFactorizations == NULL) {
+        free(arena);
+        return NULL;
+    }
+
+    return arena;
+}
+
+void PrimeFactorizationArena_free(PrimeFactorizationArena *arena) {
+    if (arena != NULL) {
+        free(arena->primeFactorizations);
+        arena->primeFactorizations = NULL;
+        free(arena);
+    }
+}
+
+PrimeFactorization *PrimeFactorizationArena_alloc(PrimeFactorizationArena *arena, unsigned int number) {
+    assert(arena != NULL);
+
+    if (arena->count == arena->capacity) {
+        return NULL;
+    }
+
+    PrimeFactorization *primeFactorization = &(arena->primeFactorizations)[arena->count];
+    (arena->count)++;
+    PrimeFactorization_init(primeFactorization, number);
+
+    return primeFactorization;
+}
+
+void PrimeFactorizationArena_reset(PrimeFactorizationArena *arena) {
+    assert(arena != NULL);
+
+    arena->count = 0;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file PrimeFactorizationArena.h
+ * @author Andrew SASSOYE
+ */
+#ifndef DEV3_PRIMEFACTORIZATIONARENA_H
+#define DEV3_PRIMEFACTORIZATIONARENA_H
+
+#include "PrimeFactorization.h"
+
+/**
+ * Bloc contigu de PrimeFactorization alloué une seule fois, dans
+ * lequel les décompositions sont réservées les unes à la suite des
+ * autres. Les décompositions réservées ne se libèrent pas une à une
+ * mais toutes ensemble via PrimeFactorizationArena_reset().
+ */
+typedef struct PrimeFactorizationArena {
+    unsigned count;
+    unsigned capacity;
+    PrimeFactorization *primeFactorizations;
+} PrimeFactorizationArena;
+
+PrimeFactorizationArena *PrimeFactorizationArena_new(unsigned capacity);
+
+void PrimeFactorizationArena_free(PrimeFactorizationArena *arena);
+
+PrimeFactorization *PrimeFactorizationArena_alloc(PrimeFactorizationArena *arena, unsigned number);
+
+void PrimeFactorizationArena_reset(PrimeFactorizationArena *arena);
+
+#endif //DEV3_PRIMEFACTORIZATIONARENA_H
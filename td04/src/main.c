@@ -73,4 +73,13 @@ int main() {
 
     PrimeFactorization_print(f);
     PrimeFactorization_free(f);
+
+    printf("\n\n\tDECOMPOSITION D'UN INTERVALLE\n");
+    PrimeFactorizationArena *arena = PrimeFactorizationArena_new(1000);
+    PrimeFactorization *range = primeFactorsRange(arena, 80, 90);
+    for (int i = 0; i <= 90 - 80; ++i) {
+        PrimeFactorization_print(&range[i]);
+        printf("\n");
+    }
+    PrimeFactorizationArena_free(arena);
 }
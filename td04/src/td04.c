@@ -11,7 +11,7 @@
 unsigned *primeFactorsA(unsigned *count, unsigned number) {
     assert(*count == 0);
 
-    unsigned *decomposition = malloc(sizeof(unsigned) * number);
+    unsigned *decomposition = malloc(sizeof(unsigned) * PRIMEFACTORS_MAX_COUNT);
 
     if (decomposition == NULL) {
         return NULL;
@@ -43,12 +43,12 @@ unsigned primeFactorsB(unsigned **factor, unsigned **multiplicity, unsigned numb
     assert(*factor == NULL);
     assert(*multiplicity == NULL);
 
-    *factor = malloc(sizeof(unsigned) * number);
+    *factor = malloc(sizeof(unsigned) * PRIMEFACTORIZATION_CAPACITY);
     if (*factor == NULL) {
         return 0;
     }
 
-    *multiplicity = malloc(sizeof(unsigned) * number);
+    *multiplicity = malloc(sizeof(unsigned) * PRIMEFACTORIZATION_CAPACITY);
     if (*multiplicity == NULL) {
         free(*factor);
         *factor = NULL;
@@ -83,7 +83,7 @@ unsigned primeFactorsB(unsigned **factor, unsigned **multiplicity, unsigned numb
 PrimeFactor *primeFactorsC(unsigned int *count, unsigned int number) {
     assert(*count == 0);
 
-    PrimeFactor *decomposition = malloc(sizeof(PrimeFactor) * number);
+    PrimeFactor *decomposition = malloc(sizeof(PrimeFactor) * PRIMEFACTORIZATION_CAPACITY);
 
     if (decomposition == NULL) {
         return NULL;
@@ -132,6 +132,20 @@ void primeFactorD(PrimeFactorization *primeFactorization) {
 
         prime = nextPrime(prime);
     }
+}
+
+PrimeFactorization *primeFactorsRange(PrimeFactorizationArena *arena, unsigned int lower, unsigned int higher) {
+    assert(arena != NULL);
+    assert(0 < lower && lower <= higher);
+
+    if (arena->capacity - arena->count <= higher - lower) {
+        return NULL;
+    }
+
+    PrimeFactorization *first = &(arena->primeFactorizations)[arena->count];
+    for (unsigned i = 0; i <= higher - lower; ++i) {
+        primeFactorD(PrimeFactorizationArena_alloc(arena, lower + i));
+    }
 
-    PrimeFactorization_resizePrimeFactorsArray(primeFactorization);
+    return first;
 }
@@ -7,6 +7,13 @@
 
 #include "PrimeFactor.h"
 #include "PrimeFactorization.h"
+#include "PrimeFactorizationArena.h"
+
+/**
+ * Nombre maximal de facteurs premiers, multiplicités comprises,
+ * d'un unsigned : 2^31 en compte 31.
+ */
+#define PRIMEFACTORS_MAX_COUNT 32
 
 unsigned *primeFactorsA(unsigned *count, unsigned number);
 
@@ -16,4 +23,6 @@ PrimeFactor *primeFactorsC(unsigned *count, unsigned number);
 
 void primeFactorD(PrimeFactorization *primeFactorization);
 
+PrimeFactorization *primeFactorsRange(PrimeFactorizationArena *arena, unsigned lower, unsigned higher);
+
 #endif //DEV3_TD04_H
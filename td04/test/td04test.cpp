@@ -0,0 +1,110 @@
+#include "catch2/catch.hpp"
+
+extern "C" {
+#include "../src/td04.h"
+}
+
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+/*
+ * Plus grand produit de nombres premiers distincts tenant dans un
+ * unsigned : 2 * 3 * 5 * ... * 23, neuf facteurs. Le suivant,
+ * multiplié par 29, dépasse 2^32.
+ */
+const unsigned PRIMORIAL_23 = 223092870u;
+
+std::vector<unsigned> values(const PrimeFactorization &f) {
+    std::vector<unsigned> result;
+    for (unsigned i = 0; i < f.count; ++i) {
+        result.push_back(f.primeFactors[i].value);
+    }
+    return result;
+}
+
+}
+
+TEST_CASE("primeFactorD au maximum de facteurs distincts", "[td04]") {
+    REQUIRE(PRIMEFACTORIZATION_CAPACITY >= 9);
+
+    PrimeFactorization f;
+    PrimeFactorization_init(&f, PRIMORIAL_23);
+    primeFactorD(&f);
+    REQUIRE(values(f) == std::vector<unsigned>{2, 3, 5, 7, 11, 13, 17, 19, 23});
+    for (unsigned i = 0; i < f.count; ++i) {
+        REQUIRE(f.primeFactors[i].multiplicity == 1);
+    }
+
+    PrimeFactorization_init(&f, 4294967295u);
+    primeFactorD(&f);
+    REQUIRE(values(f) == std::vector<unsigned>{3, 5, 17, 257, 65537});
+
+    PrimeFactorization_init(&f, 2147483648u);
+    primeFactorD(&f);
+    REQUIRE(f.count == 1);
+    REQUIRE(f.primeFactors[0].value == 2);
+    REQUIRE(f.primeFactors[0].multiplicity == 31);
+}
+
+TEST_CASE("primeFactorsA au maximum de facteurs avec multiplicité", "[td04]") {
+    unsigned count = 0;
+    unsigned *factors = primeFactorsA(&count, 2147483648u);
+    REQUIRE(count == 31);
+    REQUIRE(count <= PRIMEFACTORS_MAX_COUNT);
+    for (unsigned i = 0; i < count; ++i) {
+        REQUIRE(factors[i] == 2);
+    }
+    std::free(factors);
+
+    count = 0;
+    factors = primeFactorsA(&count, 3u * 1073741824u);
+    REQUIRE(count == 31);
+    REQUIRE(factors[30] == 3);
+    std::free(factors);
+}
+
+TEST_CASE("primeFactorsB et primeFactorsC au maximum de facteurs distincts", "[td04]") {
+    unsigned *factor = nullptr;
+    unsigned *multiplicity = nullptr;
+    REQUIRE(primeFactorsB(&factor, &multiplicity, PRIMORIAL_23) == 9);
+    REQUIRE(factor[8] == 23);
+    REQUIRE(multiplicity[8] == 1);
+    std::free(factor);
+    std::free(multiplicity);
+
+    unsigned count = 0;
+    PrimeFactor *decomposition = primeFactorsC(&count, PRIMORIAL_23);
+    REQUIRE(count == 9);
+    REQUIRE(decomposition[0].value == 2);
+    REQUIRE(decomposition[8].value == 23);
+    std::free(decomposition);
+}
+
+TEST_CASE("primeFactorsRange remplit l'arène sans la dépasser", "[td04]") {
+    PrimeFactorizationArena *arena = PrimeFactorizationArena_new(11);
+    REQUIRE(arena != nullptr);
+
+    PrimeFactorization *range = primeFactorsRange(arena, 80, 90);
+    REQUIRE(range != nullptr);
+    REQUIRE(arena->count == 11);
+    REQUIRE(range[0].number == 80);
+    REQUIRE(values(range[0]) == std::vector<unsigned>{2, 5});
+    REQUIRE(range[0].primeFactors[0].multiplicity == 4);
+    REQUIRE(range[9].number == 89);
+    REQUIRE(values(range[9]) == std::vector<unsigned>{89});
+
+    REQUIRE(PrimeFactorizationArena_alloc(arena, 91) == nullptr);
+    REQUIRE(primeFactorsRange(arena, 91, 91) == nullptr);
+
+    PrimeFactorizationArena_reset(arena);
+    REQUIRE(primeFactorsRange(arena, 1, 12) == nullptr);
+    REQUIRE(arena->count == 0);
+    range = primeFactorsRange(arena, 1, 11);
+    REQUIRE(range != nullptr);
+    REQUIRE(range[0].count == 0);
+    REQUIRE(values(range[10]) == std::vector<unsigned>{11});
+
+    PrimeFactorizationArena_free(arena);
+}
@@ -5,6 +5,7 @@
 
 #include "slcircularlist.h"
 #include "slcircularlist_utility.h"
+#include "slcircularlist_index.h"
 
 int main() {
     struct SLCircularList *list = newSLCL();
@@ -69,6 +70,20 @@ int main() {
     eraseSLCL(list, value69);
     printList(list, true);
 
+    puts("\n\t===Index positionnel===");
+    for (int i = 0; i < 20; ++i) {
+        pushSLCL(list, 100 + i);
+    }
+    setIndexModeSLCL(list, SLCLCHECKPOINTS, 4);
+    printList(list, true);
+    position = 13;
+    printf("L'élement a la position %zd est %d\n", position, valueSLN(getSLCNByPositionSLCN(list, position)));
+    pushSLCL(list, 7);
+    printf("L'élement a la position %zd est %d\n", position, valueSLN(getSLCNByPositionSLCN(list, position)));
+    eraseSLCL(list, getSLCNByPositionSLCN(list, 3));
+    printf("L'élement a la position %zd est %d\n", position, valueSLN(getSLCNByPositionSLCN(list, position)));
+    printf("Taille de la liste : %zd\n", sizeSLCL(list));
+
     puts("\n\t===Free the list===");
     deleteSLCL(&list);
     printf("&liste = %p => %s\n", (void *) list, list == NULL ? "OK" : "KO");
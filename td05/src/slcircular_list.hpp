@@ -0,0 +1,669 @@
+/*!
+ * \file slcircular_list.hpp
+ * \author Andrew SASSOYE
+ *
+ * \brief Définition du modèle de classe g54327::slcircular_list,
+ *        version générique de struct SLCircularList.
+ */
+#ifndef DEV3_SLCIRCULAR_LIST_HPP
+#define DEV3_SLCIRCULAR_LIST_HPP
+
+#include <cstddef>
+#include <memory>
+#include <iterator>
+#include <utility>
+#include <initializer_list>
+#include <type_traits>
+
+/*!
+ * \brief DEV3 namespace
+ */
+namespace g54327 {
+
+/*!
+ * \brief Liste circulaire simplement chaînée générique.
+ *
+ * Reprend la sémantique de struct SLCircularList : une
+ * sentinelle sert d'entrée de liste, `push()` et `pop()`
+ * travaillent en entrée, `insert()` place le nouvel élément
+ * _avant_ celui indiqué et `erase()` retourne l'élément suivant
+ * celui supprimé.
+ *
+ * Contrairement à la version C dont le `value_t` est un `int`,
+ * les éléments sont de type `T` quelconque, éventuellement
+ * uniquement déplaçable (`std::unique_ptr` par exemple), et sont
+ * construits en place dans les nœuds. Les nœuds sont alloués via
+ * `Allocator`, _rebindé_ sur le type des nœuds.
+ *
+ * La sentinelle fait partie de l'objet liste : une liste vide
+ * n'alloue rien. Le dernier élément est mémorisé afin de pouvoir
+ * refermer le cercle sur la sentinelle lors d'un déplacement de
+ * la liste.
+ *
+ * \tparam T type des éléments.
+ * \tparam Allocator allocateur des éléments.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class slcircular_list {
+  /*!
+   * \brief Partie chaînage d'un nœud, seule présente dans la
+   *        sentinelle.
+   */
+  struct node_base {
+    /*!
+     * \brief Nœud suivant, la sentinelle après le dernier.
+     */
+    node_base *next;
+  };
+
+  /*!
+   * \brief Nœud portant une valeur.
+   */
+  struct node : node_base {
+    /*!
+     * \brief Valeur conservée par le nœud.
+     */
+    T value;
+
+    /*!
+     * \brief Construction en place de la valeur.
+     *
+     * \param args arguments transmis au constructeur de `T`.
+     */
+    template<typename... Args>
+    explicit node(Args &&... args) :
+        node_base{nullptr},
+        value(std::forward<Args>(args)...) {}
+  };
+
+  using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  /*!
+   * \brief Itérateur générique, `Const` choisissant l'accès en
+   *        lecture seule.
+   */
+  template<bool Const>
+  class basic_iterator {
+    friend class slcircular_list;
+
+    template<bool>
+    friend class basic_iterator;
+
+    using base_pointer = std::conditional_t<Const, const node_base *, node_base *>;
+
+    base_pointer current_;
+
+    explicit basic_iterator(base_pointer current) : current_{current} {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() : current_{nullptr} {}
+
+    /*!
+     * \brief Conversion d'un itérateur en itérateur constant.
+     */
+    template<bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false> &other) : current_{other.current_} {}
+
+    reference operator*() const {
+      return static_cast<std::conditional_t<Const, const node *, node *>>(current_)->value;
+    }
+
+    pointer operator->() const {
+      return std::addressof(**this);
+    }
+
+    basic_iterator &operator++() {
+      current_ = current_->next;
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator old{*this};
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const basic_iterator &lhs, const basic_iterator &rhs) {
+      return lhs.current_ == rhs.current_;
+    }
+
+    friend bool operator!=(const basic_iterator &lhs, const basic_iterator &rhs) {
+      return lhs.current_ != rhs.current_;
+    }
+  };
+
+  /*!
+   * \brief Sentinelle, entrée de la liste.
+   */
+  node_base sentinel_;
+
+  /*!
+   * \brief Dernier nœud de la liste, la sentinelle si la liste
+   *        est vide.
+   */
+  node_base *last_;
+
+  /*!
+   * \brief Nombre d'éléments.
+   */
+  std::size_t size_;
+
+  /*!
+   * \brief Allocateur des nœuds.
+   */
+  node_allocator allocator_;
+
+  template<typename... Args>
+  inline node *create_node(Args &&... args);
+
+  inline void destroy_node(node_base *pNode);
+
+  inline node_base *link_after(node_base *previous, node *pNode);
+
+  inline node_base *previous(const node_base *pNode) const;
+
+  inline void steal(slcircular_list &other) noexcept;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  /*!
+   * \brief Constructeur d'une liste vide.
+   *
+   * \param allocator allocateur des éléments.
+   */
+  inline explicit slcircular_list(const Allocator &allocator = Allocator{});
+
+  /*!
+   * \brief Constructeur à partir d'une liste d'initialisation.
+   *
+   * L'ordre des éléments est conservé.
+   *
+   * \param values valeurs des éléments.
+   * \param allocator allocateur des éléments.
+   */
+  inline slcircular_list(std::initializer_list<T> values,
+                         const Allocator &allocator = Allocator{});
+
+  /*!
+   * \brief Constructeur par recopie.
+   */
+  inline slcircular_list(const slcircular_list &other);
+
+  /*!
+   * \brief Constructeur par déplacement.
+   *
+   * Les nœuds de `other` sont repris sans allocation, `other`
+   * devient vide.
+   */
+  inline slcircular_list(slcircular_list &&other) noexcept;
+
+  /*!
+   * \brief Destructeur, détruit tous les éléments.
+   */
+  inline ~slcircular_list();
+
+  /*!
+   * \brief Affectation par recopie.
+   */
+  inline slcircular_list &operator=(const slcircular_list &other);
+
+  /*!
+   * \brief Affectation par déplacement.
+   *
+   * Si les allocateurs ne peuvent pas être échangés, les éléments
+   * sont déplacés un à un.
+   */
+  inline slcircular_list &operator=(slcircular_list &&other) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value);
+
+  /*!
+   * \brief Accesseur en lecture de l'allocateur.
+   */
+  inline allocator_type get_allocator() const;
+
+  inline iterator begin() noexcept;
+  inline const_iterator begin() const noexcept;
+  inline const_iterator cbegin() const noexcept;
+
+  /*!
+   * \brief Itérateur sur la sentinelle.
+   */
+  inline iterator end() noexcept;
+  inline const_iterator end() const noexcept;
+  inline const_iterator cend() const noexcept;
+
+  /*!
+   * \brief Élément suivant en tournant dans le cercle.
+   *
+   * Équivalent de getNextSLCN() : la sentinelle est sautée, le
+   * suivant du dernier élément est le premier.
+   *
+   * Si la liste est vide ou si `position` est end(), le
+   * comportement est indéterminé.
+   */
+  inline iterator circular_next(const_iterator position);
+
+  /*!
+   * \brief Accès en lecture de la nature vide ou non de la liste.
+   */
+  inline bool empty() const noexcept;
+
+  /*!
+   * \brief Nombre d'éléments, en temps constant.
+   */
+  inline size_type size() const noexcept;
+
+  /*!
+   * \brief Élément en entrée de liste.
+   *
+   * Si la liste est vide, le comportement est indéterminé.
+   */
+  inline reference front();
+  inline const_reference front() const;
+
+  /*!
+   * \brief Insertion d'un élément en entrée de liste.
+   *
+   * \return itérateur sur l'élément inséré.
+   */
+  inline iterator push(const T &value);
+  inline iterator push(T &&value);
+
+  /*!
+   * \brief Construction en place d'un élément en entrée de liste.
+   *
+   * \param args arguments transmis au constructeur de `T`.
+   *
+   * \return itérateur sur l'élément inséré.
+   */
+  template<typename... Args>
+  inline iterator emplace_front(Args &&... args);
+
+  /*!
+   * \brief Insertion d'un élément à la place de celui pointé par
+   *        `position`, ce dernier devenant son suivant.
+   *
+   * Comme insertSLCL(), le précédent de `position` doit être
+   * recherché : l'insertion est linéaire sauf en entrée
+   * (`begin()`) et en fin (`end()`).
+   *
+   * \return itérateur sur l'élément inséré.
+   */
+  inline iterator insert(const_iterator position, const T &value);
+  inline iterator insert(const_iterator position, T &&value);
+
+  /*!
+   * \brief Construction en place d'un élément à la place de celui
+   *        pointé par `position`.
+   *
+   * \see insert()
+   */
+  template<typename... Args>
+  inline iterator emplace(const_iterator position, Args &&... args);
+
+  /*!
+   * \brief Construction en place d'un élément après celui pointé
+   *        par `position`, en temps constant.
+   *
+   * `position` peut être end() : l'élément est alors inséré en
+   * entrée de liste.
+   */
+  template<typename... Args>
+  inline iterator emplace_after(const_iterator position, Args &&... args);
+
+  /*!
+   * \brief Suppression de l'élément en entrée de liste.
+   *
+   * Si la liste est vide, le comportement est indéterminé.
+   *
+   * \return itérateur sur la nouvelle entrée de liste, end() si
+   *         elle est désormais vide.
+   */
+  inline iterator pop();
+
+  /*!
+   * \brief Suppression de l'élément pointé par `position`.
+   *
+   * Comme eraseSLCL(), le précédent de `position` doit être
+   * recherché.
+   *
+   * \return itérateur sur l'élément suivant celui supprimé, end()
+   *         si c'était le dernier.
+   */
+  inline iterator erase(const_iterator position);
+
+  /*!
+   * \brief Suppression de l'élément suivant `position`, en temps
+   *        constant.
+   *
+   * `position` peut être end() : l'élément supprimé est alors
+   * l'entrée de liste.
+   *
+   * \return itérateur sur l'élément suivant celui supprimé.
+   */
+  inline iterator erase_after(const_iterator position);
+
+  /*!
+   * \brief Destruction de tous les éléments.
+   */
+  inline void clear() noexcept;
+};
+
+// implémentation méthodes inline
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename slcircular_list<T, Allocator>::node *
+slcircular_list<T, Allocator>::create_node(Args &&... args) {
+  node *pNode = node_traits::allocate(allocator_, 1);
+  try {
+    node_traits::construct(allocator_, pNode, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(allocator_, pNode, 1);
+    throw;
+  }
+  return pNode;
+}
+
+template<typename T, typename Allocator>
+void slcircular_list<T, Allocator>::destroy_node(node_base *pNode) {
+  node *pValue = static_cast<node *>(pNode);
+  node_traits::destroy(allocator_, pValue);
+  node_traits::deallocate(allocator_, pValue, 1);
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::node_base *
+slcircular_list<T, Allocator>::link_after(node_base *previous, node *pNode) {
+  pNode->next = previous->next;
+  previous->next = pNode;
+  if (previous == last_) {
+    last_ = pNode;
+  }
+  ++size_;
+  return pNode;
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::node_base *
+slcircular_list<T, Allocator>::previous(const node_base *pNode) const {
+  if (pNode == &sentinel_) {
+    return last_;
+  }
+
+  const node_base *actual = &sentinel_;
+  while (actual->next != pNode) {
+    actual = actual->next;
+  }
+  return const_cast<node_base *>(actual);
+}
+
+template<typename T, typename Allocator>
+void slcircular_list<T, Allocator>::steal(slcircular_list &other) noexcept {
+  if (other.size_ == 0) {
+    return;
+  }
+
+  sentinel_.next = other.sentinel_.next;
+  last_ = other.last_;
+  last_->next = &sentinel_;
+  size_ = other.size_;
+
+  other.sentinel_.next = &other.sentinel_;
+  other.last_ = &other.sentinel_;
+  other.size_ = 0;
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator>::slcircular_list(const Allocator &allocator) :
+    sentinel_{&sentinel_},
+    last_{&sentinel_},
+    size_{0},
+    allocator_{allocator} {}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator>::slcircular_list(std::initializer_list<T> values,
+                                               const Allocator &allocator) :
+    slcircular_list(allocator) {
+  for (const auto &value : values) {
+    emplace_after(const_iterator{last_}, value);
+  }
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator>::slcircular_list(const slcircular_list &other) :
+    slcircular_list(node_traits::select_on_container_copy_construction(other.allocator_)) {
+  for (const auto &value : other) {
+    emplace_after(const_iterator{last_}, value);
+  }
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator>::slcircular_list(slcircular_list &&other) noexcept :
+    sentinel_{&sentinel_},
+    last_{&sentinel_},
+    size_{0},
+    allocator_{std::move(other.allocator_)} {
+  steal(other);
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator>::~slcircular_list() {
+  clear();
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator> &
+slcircular_list<T, Allocator>::operator=(const slcircular_list &other) {
+  if (this != &other) {
+    clear();
+    if (node_traits::propagate_on_container_copy_assignment::value) {
+      allocator_ = other.allocator_;
+    }
+    for (const auto &value : other) {
+      emplace_after(const_iterator{last_}, value);
+    }
+  }
+  return *this;
+}
+
+template<typename T, typename Allocator>
+slcircular_list<T, Allocator> &
+slcircular_list<T, Allocator>::operator=(slcircular_list &&other) noexcept(
+    node_traits::propagate_on_container_move_assignment::value ||
+    node_traits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+
+  clear();
+  if (node_traits::propagate_on_container_move_assignment::value) {
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+  } else if (allocator_ == other.allocator_) {
+    steal(other);
+  } else {
+    for (auto &value : other) {
+      emplace_after(const_iterator{last_}, std::move(value));
+    }
+    other.clear();
+  }
+  return *this;
+}
+
+template<typename T, typename Allocator>
+Allocator slcircular_list<T, Allocator>::get_allocator() const {
+  return Allocator{allocator_};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::begin() noexcept {
+  return iterator{sentinel_.next};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::const_iterator
+slcircular_list<T, Allocator>::begin() const noexcept {
+  return const_iterator{sentinel_.next};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::const_iterator
+slcircular_list<T, Allocator>::cbegin() const noexcept {
+  return begin();
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::end() noexcept {
+  return iterator{&sentinel_};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::const_iterator
+slcircular_list<T, Allocator>::end() const noexcept {
+  return const_iterator{&sentinel_};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::const_iterator
+slcircular_list<T, Allocator>::cend() const noexcept {
+  return end();
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::circular_next(const_iterator position) {
+  node_base *next = const_cast<node_base *>(position.current_)->next;
+  return iterator{next == &sentinel_ ? sentinel_.next : next};
+}
+
+template<typename T, typename Allocator>
+bool slcircular_list<T, Allocator>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::size_type
+slcircular_list<T, Allocator>::size() const noexcept {
+  return size_;
+}
+
+template<typename T, typename Allocator>
+T &slcircular_list<T, Allocator>::front() {
+  return *begin();
+}
+
+template<typename T, typename Allocator>
+const T &slcircular_list<T, Allocator>::front() const {
+  return *begin();
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::push(const T &value) {
+  return emplace_front(value);
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::push(T &&value) {
+  return emplace_front(std::move(value));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::emplace_front(Args &&... args) {
+  return emplace_after(cend(), std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::insert(const_iterator position, const T &value) {
+  return emplace(position, value);
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::insert(const_iterator position, T &&value) {
+  return emplace(position, std::move(value));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::emplace(const_iterator position, Args &&... args) {
+  return emplace_after(const_iterator{previous(position.current_)},
+                       std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::emplace_after(const_iterator position, Args &&... args) {
+  node *pNode = create_node(std::forward<Args>(args)...);
+  return iterator{link_after(const_cast<node_base *>(position.current_), pNode)};
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::pop() {
+  return erase_after(cend());
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::erase(const_iterator position) {
+  return erase_after(const_iterator{previous(position.current_)});
+}
+
+template<typename T, typename Allocator>
+typename slcircular_list<T, Allocator>::iterator
+slcircular_list<T, Allocator>::erase_after(const_iterator position) {
+  node_base *previous = const_cast<node_base *>(position.current_);
+  node_base *erased = previous->next;
+
+  previous->next = erased->next;
+  if (erased == last_) {
+    last_ = previous;
+  }
+  --size_;
+  destroy_node(erased);
+
+  return iterator{previous->next};
+}
+
+template<typename T, typename Allocator>
+void slcircular_list<T, Allocator>::clear() noexcept {
+  node_base *actual = sentinel_.next;
+  while (actual != &sentinel_) {
+    node_base *next = actual->next;
+    destroy_node(actual);
+    actual = next;
+  }
+  sentinel_.next = &sentinel_;
+  last_ = &sentinel_;
+  size_ = 0;
+}
+
+}
+
+#endif //DEV3_SLCIRCULAR_LIST_HPP
@@ -1,5 +1,6 @@
 #include "slcircularlist.h"
 #include "slcircularlist_utility.h"
+#include "slcircularlist_index.h"
 #include <stdlib.h>
 #include <errno.h>
 #include <assert.h>
@@ -21,6 +22,7 @@ struct SLCircularList *newSLCL(void) {
     }
     sentinel->next = sentinel;
     list->entry = sentinel;
+    list->index = NULL;
 
     return list;
 }
@@ -32,6 +34,9 @@ void deleteSLCL(struct SLCircularList **adpSLCL) {
     // Clear the list
     clearSLCL(*adpSLCL);
 
+    // Free the index
+    setIndexModeSLCL(*adpSLCL, SLCLNOINDEX, 0);
+
     // Free the sentinel
     struct SLNode *sentinel = (*adpSLCL)->entry;
     deleteSLN(&sentinel);
@@ -53,6 +58,7 @@ void clearSLCL(struct SLCircularList *pSLCL) {
         actual = next;
     }
     sentinel->next = sentinel;
+    updateIndexSLCL(pSLCL, SLCLCLEARED);
 }
 
 struct SLNode *entrySLCL(const struct SLCircularList *pSLCL) {
@@ -81,6 +87,7 @@ struct SLNode *pushSLCL(struct SLCircularList *pSLCL, value_t value) {
 
     setNextSLN(newElement, nextSLN(sentinel));
     setNextSLN(sentinel, newElement);
+    updateIndexSLCL(pSLCL, SLCLPUSHED);
 
     return newElement;
 }
@@ -96,8 +103,14 @@ struct SLNode *insertSLCL(struct SLCircularList *pSLCL, struct SLNode *pSLN, val
     struct SLNode *previous = previousSLCL(pSLCL, pSLN);
     struct SLNode *new = newSLN(value);
 
+    if (new == NULL) {
+        errno = ESLLMEMORYFAIL;
+        return pSLN;
+    }
+
     setNextSLN(new, pSLN);
     setNextSLN(previous, new);
+    updateIndexSLCL(pSLCL, SLCLINSERTED);
 
     return new;
 }
@@ -114,6 +127,7 @@ struct SLNode *popSLCL(struct SLCircularList *pSLCL) {
     struct SLNode *actual = sentinel->next;
     sentinel->next = actual->next;
     deleteSLN(&actual);
+    updateIndexSLCL(pSLCL, SLCLPOPPED);
 
     return sentinel->next == sentinel ? NULL : sentinel->next;
 }
@@ -132,6 +146,7 @@ struct SLNode *eraseSLCL(struct SLCircularList *pSLCL, struct SLNode *pSLN) {
     struct SLNode *previous = previousSLCL(pSLCL, pSLN);
     setNextSLN(previous, nextSLN(pSLN));
     deleteSLN(&pSLN);
+    updateIndexSLCL(pSLCL, SLCLERASED);
 
     return getNextSLCN(pSLCL, previous);
 }
@@ -12,6 +12,8 @@
 
 #include "slnode.h"
 
+struct SLCLIndex;
+
 /*!
  * \brief Valeurs d'erreurs associées à une liste.
  */
@@ -38,13 +40,23 @@ struct SLCircularList {
      * \brief Entrée dans la liste circulaire.
      */
     struct SLNode *entry;
+
+    /*!
+     * \brief Index positionnel optionnel de la liste.
+     *
+     * Vaut `NULL` tant que l'index n'a pas été activé via
+     * setIndexModeSLCL() : une liste sans index ne paie alors
+     * qu'un test de pointeur par modification.
+     */
+    struct SLCLIndex *index;
 };
 
 /*!
  * \brief Création d'une liste circulaire simplement chaînée.
  *
  * La liste est créée vide, c'est-à-dire que son champ `entry`
- * est mis à `NULL`.
+ * pointe sur une sentinelle qui est sa propre suivante. Elle est
+ * créée sans index positionnel.
  *
  * Si l'allocation dynamique échoue :
  *   + `errno` est mis à ::ESLLMEMORYFAIL ;
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include <errno.h>
+#include <assert.h>
+#include "slcircularlist_index.h"
+#include "slcircularlist_utility.h"
+#include "slnode_utility.h"
+
+bool setIndexModeSLCL(struct SLCircularList *pSLCL, enum SLCLIndexMode mode, size_t step) {
+    assert(pSLCL != NULL);
+
+    if (mode == SLCLNOINDEX) {
+        if (pSLCL->index != NULL) {
+            free(pSLCL->index->checkpoints);
+            free(pSLCL->index);
+            pSLCL->index = NULL;
+        }
+        return true;
+    }
+
+    assert(step > 0);
+
+    if (pSLCL->index == NULL) {
+        struct SLCLIndex *index = malloc(sizeof(struct SLCLIndex));
+
+        if (index == NULL) {
+            errno = ESLLMEMORYFAIL;
+            return false;
+        }
+
+        index->size = sizeSLCL(pSLCL);
+        index->count = 0;
+        index->capacity = 0;
+        index->checkpoints = NULL;
+        pSLCL->index = index;
+    }
+
+    pSLCL->index->step = step;
+    pSLCL->index->valid = false;
+
+    return rebuildIndexSLCL(pSLCL);
+}
+
+enum SLCLIndexMode indexModeSLCL(const struct SLCircularList *pSLCL) {
+    assert(pSLCL != NULL);
+
+    return pSLCL->index == NULL ? SLCLNOINDEX : SLCLCHECKPOINTS;
+}
+
+bool rebuildIndexSLCL(const struct SLCircularList *pSLCL) {
+    assert(pSLCL != NULL);
+
+    struct SLCLIndex *index = pSLCL->index;
+    if (index == NULL) {
+        return true;
+    }
+
+    size_t count = (index->size + index->step - 1) / index->step;
+    if (count > index->capacity) {
+        struct SLNode **checkpoints = realloc(index->checkpoints, count * sizeof(struct SLNode *));
+
+        if (checkpoints == NULL) {
+            index->valid = false;
+            errno = ESLLMEMORYFAIL;
+            return false;
+        }
+
+        index->checkpoints = checkpoints;
+        index->capacity = count;
+    }
+
+    struct SLNode *sentinel = entrySLCL(pSLCL);
+    struct SLNode *actual = nextSLN(sentinel);
+    for (size_t i = 0; actual != sentinel; ++i) {
+        if (i % index->step == 0) {
+            index->checkpoints[i / index->step] = actual;
+        }
+        actual = nextSLN(actual);
+    }
+
+    index->count = count;
+    index->shift = 0;
+    index->valid = true;
+
+    return true;
+}
+
+void updateIndexSLCL(struct SLCircularList *pSLCL, enum SLCLIndexEvent event) {
+    assert(pSLCL != NULL);
+
+    struct SLCLIndex *index = pSLCL->index;
+    if (index == NULL) {
+        return;
+    }
+
+    switch (event) {
+        case SLCLPUSHED:
+            ++(index->size);
+            if (index->valid && ++(index->shift) >= index->step) {
+                index->valid = false;
+            }
+            break;
+        case SLCLPOPPED:
+            --(index->size);
+            if (index->valid && index->shift == 0) {
+                // the popped element was the first checkpoint
+                index->valid = false;
+            } else if (index->valid) {
+                --(index->shift);
+            }
+            break;
+        case SLCLINSERTED:
+            ++(index->size);
+            index->valid = false;
+            break;
+        case SLCLERASED:
+            --(index->size);
+            index->valid = false;
+            break;
+        case SLCLCLEARED:
+            index->size = 0;
+            index->count = 0;
+            index->valid = false;
+            break;
+    }
+}
+
+struct SLNode *positionIndexSLCL(const struct SLCircularList *pSLCL, size_t position) {
+    assert(pSLCL != NULL);
+    assert(pSLCL->index != NULL);
+
+    struct SLCLIndex *index = pSLCL->index;
+    if (index->size == 0) {
+        return NULL;
+    }
+
+    position %= index->size;
+    struct SLNode *first = nextSLN(entrySLCL(pSLCL));
+
+    if (!index->valid && !rebuildIndexSLCL(pSLCL)) {
+        return forwardSLN(first, position);
+    }
+
+    if (position < index->shift) {
+        return forwardSLN(first, position);
+    }
+
+    size_t relative = position - index->shift;
+
+    return forwardSLN(index->checkpoints[relative / index->step], relative % index->step);
+}
@@ -0,0 +1,222 @@
+/*!
+ * \file slcircularlist_index.h
+ *
+ * \brief Définition d'un index positionnel optionnel pour
+ *        struct SLCircularList.
+ *
+ * L'index conserve l'adresse d'un élément tous les `step`
+ * éléments de la liste (_checkpoints_). L'accès à un élément par
+ * sa position ne parcourt alors plus que `step` éléments au plus
+ * au lieu de toute la liste.
+ */
+#ifndef DEV3_SLCIRCULARLIST_INDEX_H
+#define DEV3_SLCIRCULARLIST_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "slcircularlist.h"
+
+/*!
+ * \brief Mode d'indexation d'une liste.
+ */
+enum SLCLIndexMode {
+    /*!
+     * \brief Pas d'index : les accès positionnels parcourent la
+     *        liste élément par élément.
+     */
+    SLCLNOINDEX,
+
+    /*!
+     * \brief Index par _checkpoints_ tous les `step` éléments.
+     */
+    SLCLCHECKPOINTS
+};
+
+/*!
+ * \brief Modifications de la liste dont l'index doit être averti.
+ */
+enum SLCLIndexEvent {
+    /*!
+     * \brief Un élément a été inséré en entrée de liste.
+     */
+    SLCLPUSHED,
+
+    /*!
+     * \brief L'élément d'entrée de liste a été supprimé.
+     */
+    SLCLPOPPED,
+
+    /*!
+     * \brief Un élément a été inséré ailleurs qu'en entrée.
+     */
+    SLCLINSERTED,
+
+    /*!
+     * \brief Un élément a été supprimé ailleurs qu'en entrée.
+     */
+    SLCLERASED,
+
+    /*!
+     * \brief Tous les éléments ont été supprimés.
+     */
+    SLCLCLEARED
+};
+
+/*!
+ * \brief Structure représentant l'index positionnel d'une liste.
+ *
+ * `checkpoints[i]` est l'adresse de l'élément en position
+ * `i * step + shift`. Les insertions et suppressions en entrée
+ * de liste ne font que modifier `shift` ; les autres
+ * modifications invalident l'index qui est reconstruit au
+ * prochain accès positionnel.
+ */
+struct SLCLIndex {
+    /*!
+     * \brief Distance entre deux _checkpoints_.
+     */
+    size_t step;
+
+    /*!
+     * \brief Nombre d'éléments de la liste, maintenu à chaque
+     *        modification.
+     */
+    size_t size;
+
+    /*!
+     * \brief Décalage des _checkpoints_ dû aux insertions en
+     *        entrée de liste depuis la dernière reconstruction.
+     */
+    size_t shift;
+
+    /*!
+     * \brief `true` si les _checkpoints_ sont à jour.
+     */
+    bool valid;
+
+    /*!
+     * \brief Nombre de _checkpoints_.
+     */
+    size_t count;
+
+    /*!
+     * \brief Nombre de _checkpoints_ pouvant être stockés sans
+     *        réallocation.
+     */
+    size_t capacity;
+
+    /*!
+     * \brief Tableau des _checkpoints_.
+     */
+    struct SLNode **checkpoints;
+};
+
+/*!
+ * \brief Accès en écriture du mode d'indexation d'une liste.
+ *
+ * Avec ::SLCLCHECKPOINTS, un index est alloué et construit pour la
+ * liste pointée par `pSLCL`, avec un _checkpoint_ tous les `step`
+ * éléments. Avec ::SLCLNOINDEX, l'éventuel index est détruit et
+ * `step` est ignoré.
+ *
+ * Si l'allocation de l'index échoue :
+ *   + la liste est laissée sans index ;
+ *   + `errno` est mis à ::ESLLMEMORYFAIL ;
+ *   + `false` est retourné.
+ *
+ * Si `pSLCL` est `NULL` ou si `step` est nul avec
+ * ::SLCLCHECKPOINTS, le comportement de la fonction est
+ * indéterminé.
+ *
+ * \param pSLCL adresse de la liste à indexer.
+ * \param mode mode d'indexation désiré.
+ * \param step distance entre deux _checkpoints_.
+ *
+ * \return `true` en cas de succès, `false` sinon.
+ */
+bool setIndexModeSLCL(struct SLCircularList *pSLCL,
+                      enum SLCLIndexMode mode,
+                      size_t step);
+
+/*!
+ * \brief Accès en lecture du mode d'indexation d'une liste.
+ *
+ * Si `pSLCL` est `NULL`, le comportement de la fonction est
+ * indéterminé.
+ *
+ * \param pSLCL adresse de la liste.
+ *
+ * \return mode d'indexation de la liste pointée par `pSLCL`.
+ */
+enum SLCLIndexMode indexModeSLCL(const struct SLCircularList *pSLCL);
+
+/*!
+ * \brief Reconstruction des _checkpoints_ de l'index.
+ *
+ * La liste est parcourue une fois. Si elle n'est pas indexée,
+ * rien ne se passe.
+ *
+ * L'index est un cache : la liste ne contient que son adresse et
+ * le reconstruire ne modifie ni ses éléments ni leur ordre. C'est
+ * pourquoi cette fonction, comme positionIndexSLCL(), accepte une
+ * liste `const` alors qu'elle modifie la struct SLCLIndex
+ * pointée par `pSLCL->index`. Deux lectures concurrentes d'une
+ * même liste indexée ne sont donc pas sûres.
+ *
+ * Si la réallocation du tableau des _checkpoints_ échoue :
+ *   + l'index reste invalide, les accès positionnels se font
+ *     alors par parcours ;
+ *   + `errno` est mis à ::ESLLMEMORYFAIL ;
+ *   + `false` est retourné.
+ *
+ * Si `pSLCL` est `NULL`, le comportement de la fonction est
+ * indéterminé.
+ *
+ * \param pSLCL adresse de la liste dont on désire reconstruire
+ *              l'index.
+ *
+ * \return `true` si l'index est à jour, `false` sinon.
+ */
+bool rebuildIndexSLCL(const struct SLCircularList *pSLCL);
+
+/*!
+ * \brief Mise à jour de l'index suite à une modification de la
+ *        liste.
+ *
+ * Cette fonction est appelée par les fonctions de
+ * slcircularlist.h. Si la liste n'est pas indexée, rien ne se
+ * passe.
+ *
+ * Si `pSLCL` est `NULL`, le comportement de la fonction est
+ * indéterminé.
+ *
+ * \param pSLCL adresse de la liste modifiée.
+ * \param event nature de la modification.
+ */
+void updateIndexSLCL(struct SLCircularList *pSLCL,
+                     enum SLCLIndexEvent event);
+
+/*!
+ * \brief Accès à un élément par sa position via l'index.
+ *
+ * Comme pour getSLCNByPositionSLCN(), la position est prise
+ * modulo la taille de la liste. Au plus `step` éléments sont
+ * parcourus si l'index est à jour ; sinon il est d'abord
+ * reconstruit, voir rebuildIndexSLCL() pour la modification de
+ * l'index à travers une liste `const`.
+ *
+ * Si la liste est vide, `NULL` est retourné.
+ *
+ * Si `pSLCL` est `NULL` ou si la liste n'est pas indexée, le
+ * comportement de la fonction est indéterminé.
+ *
+ * \param pSLCL adresse de la liste.
+ * \param position position de l'élément désiré.
+ *
+ * \return adresse de l'élément en position `position`.
+ */
+struct SLNode *positionIndexSLCL(const struct SLCircularList *pSLCL,
+                                 size_t position);
+
+#endif //DEV3_SLCIRCULARLIST_INDEX_H
@@ -1,10 +1,15 @@
 #include <assert.h>
 #include <stdio.h>
 #include "slcircularlist_utility.h"
+#include "slcircularlist_index.h"
 
 size_t sizeSLCL(const struct SLCircularList *pSLCL) {
     assert(pSLCL != NULL);
 
+    if (pSLCL->index != NULL) {
+        return pSLCL->index->size;
+    }
+
     size_t count = 0;
     struct SLNode *sentinel = pSLCL->entry;
     struct SLNode *actual = nextSLN(sentinel);
@@ -96,6 +101,10 @@ struct SLNode *getSLCNByPositionSLCN(const struct SLCircularList *pSLCL, size_t
         return NULL;
     }
 
+    if (pSLCL->index != NULL) {
+        return positionIndexSLCL(pSLCL, position);
+    }
+
     struct SLNode *sentinel = entrySLCL(pSLCL);
     struct SLNode *actual = nextSLN(sentinel);
 
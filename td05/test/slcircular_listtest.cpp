@@ -0,0 +1,139 @@
+#include "catch2/catch.hpp"
+#include "../src/slcircular_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace g54327;
+
+namespace {
+
+template<typename T>
+std::vector<T> to_vector(const slcircular_list<T> &list) {
+    return {list.begin(), list.end()};
+}
+
+std::size_t allocated = 0;
+
+template<typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(std::size_t n) {
+        allocated += n;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) {
+        allocated -= n;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const counting_allocator<U> &) const { return true; }
+
+    template<typename U>
+    bool operator!=(const counting_allocator<U> &) const { return false; }
+};
+
+}
+
+TEST_CASE("slcircular_list push / pop", "[push][pop]") {
+    slcircular_list<int> list;
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+
+    list.push(1);
+    list.push(2);
+    list.push(3);
+    REQUIRE(list.size() == 3);
+    REQUIRE(to_vector(list) == std::vector<int>{3, 2, 1});
+
+    REQUIRE(*list.pop() == 2);
+    list.pop();
+    REQUIRE(list.pop() == list.end());
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("slcircular_list insert / erase", "[insert][erase]") {
+    slcircular_list<int> list{1, 2, 3};
+
+    auto it = std::find(list.begin(), list.end(), 2);
+    REQUIRE(*list.insert(it, 42) == 42);
+    REQUIRE(to_vector(list) == std::vector<int>{1, 42, 2, 3});
+
+    list.insert(list.begin(), 0);
+    list.insert(list.end(), 4);
+    REQUIRE(to_vector(list) == std::vector<int>{0, 1, 42, 2, 3, 4});
+
+    it = std::find(list.begin(), list.end(), 42);
+    REQUIRE(*list.erase(it) == 2);
+    REQUIRE(list.erase(std::find(list.begin(), list.end(), 4)) == list.end());
+    list.push(5);
+    REQUIRE(to_vector(list) == std::vector<int>{5, 0, 1, 2, 3});
+    REQUIRE(list.size() == 5);
+    REQUIRE(std::distance(list.begin(), list.end()) == 5);
+}
+
+TEST_CASE("slcircular_list circular_next", "[circular_next]") {
+    slcircular_list<int> list{1, 2, 3};
+    auto last = std::find(list.begin(), list.end(), 3);
+    REQUIRE(*list.circular_next(last) == 1);
+    REQUIRE(*list.circular_next(list.begin()) == 2);
+}
+
+TEST_CASE("slcircular_list move-only elements", "[emplace][move]") {
+    slcircular_list<std::unique_ptr<std::string>> list;
+    list.emplace_front(new std::string{"b"});
+    list.push(std::make_unique<std::string>("a"));
+    list.emplace(list.end(), std::make_unique<std::string>("c"));
+    REQUIRE(*list.front() == "a");
+
+    auto moved{std::move(list)};
+    REQUIRE(list.empty());
+    REQUIRE(moved.size() == 3);
+
+    std::string joined;
+    for (const auto &e : moved) {
+        joined += *e;
+    }
+    REQUIRE(joined == "abc");
+
+    list = std::move(moved);
+    list.push(std::make_unique<std::string>("z"));
+    REQUIRE(list.size() == 4);
+    REQUIRE(**std::next(list.begin(), 3) == "c");
+}
+
+TEST_CASE("slcircular_list copy", "[copy]") {
+    slcircular_list<std::string> list{"a", "b"};
+    slcircular_list<std::string> copy{list};
+    copy.push("c");
+    REQUIRE(list.size() == 2);
+    REQUIRE(copy.size() == 3);
+
+    list = copy;
+    REQUIRE(to_vector(list) == std::vector<std::string>{"c", "a", "b"});
+}
+
+TEST_CASE("slcircular_list allocator", "[allocator]") {
+    {
+        slcircular_list<int, counting_allocator<int>> list;
+        REQUIRE(allocated == 0);
+        for (int i = 0; i < 10; ++i) {
+            list.push(i);
+        }
+        REQUIRE(allocated == 10);
+        list.pop();
+        list.erase(list.begin());
+        REQUIRE(allocated == 8);
+    }
+    REQUIRE(allocated == 0);
+}
@@ -0,0 +1,164 @@
+#include "catch2/catch.hpp"
+
+extern "C" {
+#include "../src/slcircularlist.h"
+#include "../src/slcircularlist_index.h"
+#include "../src/slcircularlist_utility.h"
+#include "../src/slnode.h"
+}
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+/*
+ * Une liste indexée et une liste sans index soumises aux mêmes
+ * opérations, ainsi qu'un std::vector de référence.
+ */
+struct Twin {
+    SLCircularList *indexed;
+    SLCircularList *walked;
+    std::vector<value_t> model;
+
+    explicit Twin(std::size_t step) : indexed{newSLCL()}, walked{newSLCL()} {
+        REQUIRE(setIndexModeSLCL(indexed, SLCLCHECKPOINTS, step));
+    }
+
+    ~Twin() {
+        deleteSLCL(&indexed);
+        deleteSLCL(&walked);
+    }
+
+    void push(value_t value) {
+        pushSLCL(indexed, value);
+        pushSLCL(walked, value);
+        model.insert(model.begin(), value);
+    }
+
+    void pop() {
+        popSLCL(indexed);
+        popSLCL(walked);
+        model.erase(model.begin());
+    }
+
+    void insert(std::size_t position, value_t value) {
+        insertSLCL(indexed, getSLCNByPositionSLCN(indexed, position), value);
+        insertSLCL(walked, getSLCNByPositionSLCN(walked, position), value);
+        model.insert(model.begin() + static_cast<std::ptrdiff_t>(position), value);
+    }
+
+    void erase(std::size_t position) {
+        eraseSLCL(indexed, getSLCNByPositionSLCN(indexed, position));
+        eraseSLCL(walked, getSLCNByPositionSLCN(walked, position));
+        model.erase(model.begin() + static_cast<std::ptrdiff_t>(position));
+    }
+
+    void check() const {
+        REQUIRE(sizeSLCL(indexed) == model.size());
+        REQUIRE(sizeSLCL(walked) == model.size());
+        if (model.empty()) {
+            REQUIRE(positionIndexSLCL(indexed, 0) == nullptr);
+            REQUIRE(getSLCNByPositionSLCN(walked, 0) == nullptr);
+            return;
+        }
+        // au-delà de la taille pour vérifier le passage modulo
+        for (std::size_t p = 0; p < 2 * model.size() + 1; ++p) {
+            value_t expected = model[p % model.size()];
+            REQUIRE(valueSLN(positionIndexSLCL(indexed, p)) == expected);
+            REQUIRE(valueSLN(getSLCNByPositionSLCN(walked, p)) == expected);
+        }
+    }
+};
+
+}
+
+TEST_CASE("L'index suit les ajouts et retraits en entrée", "[SLCLIndex]") {
+    Twin twin{3};
+    twin.check();
+
+    for (value_t v = 0; v < 10; ++v) {
+        twin.push(v);
+        twin.check();
+    }
+    while (!twin.model.empty()) {
+        twin.pop();
+        twin.check();
+    }
+    twin.push(42);
+    twin.check();
+}
+
+TEST_CASE("L'index est reconstruit après insertion ou suppression", "[SLCLIndex]") {
+    Twin twin{4};
+    for (value_t v = 0; v < 12; ++v) {
+        twin.push(v);
+    }
+    twin.insert(5, 100);
+    twin.check();
+    twin.erase(7);
+    twin.check();
+    twin.insert(twin.model.size() - 1, 200);
+    twin.check();
+    twin.erase(twin.model.size() - 1);
+    twin.check();
+    twin.erase(0);
+    twin.check();
+}
+
+TEST_CASE("L'index reste cohérent après une suite mélangée d'opérations", "[SLCLIndex]") {
+    for (std::size_t step : {1u, 2u, 5u, 16u}) {
+        Twin twin{step};
+        std::mt19937 generator{static_cast<unsigned>(step)};
+        for (int i = 0; i < 400; ++i) {
+            auto size = twin.model.size();
+            switch (generator() % 4) {
+                case 0:
+                    twin.push(i);
+                    break;
+                case 1:
+                    if (size > 0) {
+                        twin.pop();
+                    }
+                    break;
+                case 2:
+                    twin.insert(size == 0 ? 0 : generator() % size, -i);
+                    break;
+                default:
+                    if (size > 0) {
+                        twin.erase(generator() % size);
+                    }
+                    break;
+            }
+            twin.check();
+        }
+    }
+}
+
+TEST_CASE("clearSLCL vide l'index", "[SLCLIndex]") {
+    Twin twin{2};
+    for (value_t v = 0; v < 5; ++v) {
+        twin.push(v);
+    }
+    clearSLCL(twin.indexed);
+    clearSLCL(twin.walked);
+    twin.model.clear();
+    twin.check();
+    twin.push(1);
+    twin.push(2);
+    twin.check();
+}
+
+TEST_CASE("setIndexModeSLCL active et désactive l'index", "[SLCLIndex]") {
+    Twin twin{3};
+    for (value_t v = 0; v < 7; ++v) {
+        twin.push(v);
+    }
+    REQUIRE(indexModeSLCL(twin.indexed) == SLCLCHECKPOINTS);
+    REQUIRE(setIndexModeSLCL(twin.indexed, SLCLNOINDEX, 0));
+    REQUIRE(indexModeSLCL(twin.indexed) == SLCLNOINDEX);
+    REQUIRE(sizeSLCL(twin.indexed) == 7);
+    REQUIRE(setIndexModeSLCL(twin.indexed, SLCLCHECKPOINTS, 2));
+    twin.check();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file histogram.cpp
+ * @author Andrew SASSOYE
+ */
+#include <cmath>
+#include <stdexcept>
+#include "histogram.hpp"
+
+namespace g54327 {
+
+Histogram::Histogram(std::size_t bins) : counts_(bins), total_{0} {
+    if (bins == 0) {
+        throw std::invalid_argument("un histogramme a au moins une classe");
+    }
+}
+
+void Histogram::merge(const Histogram &other) {
+    if (other.bins() != bins()) {
+        throw std::invalid_argument("les histogrammes n'ont pas le même nombre de classes");
+    }
+
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+}
+
+double Histogram::frequency(std::size_t bin) const {
+    return total_ == 0 ? 0. : static_cast<double>(counts_[bin]) / static_cast<double>(total_);
+}
+
+double Histogram::chi_square() const {
+    double expected = static_cast<double>(total_) / static_cast<double>(bins());
+    if (expected == 0.) {
+        return 0.;
+    }
+
+    double result = 0.;
+    for (auto count : counts_) {
+        double delta = static_cast<double>(count) - expected;
+        result += delta * delta / expected;
+    }
+
+    return result;
+}
+
+double Histogram::chi_square_p_value() const {
+    if (bins() < 2) {
+        return 1.;
+    }
+
+    double k = static_cast<double>(bins() - 1);
+    double variance = 2. / (9. * k);
+    double z = (std::cbrt(chi_square() / k) - (1. - variance)) / std::sqrt(variance);
+
+    return 0.5 * std::erfc(z / std::sqrt(2.));
+}
+
+double Histogram::ks_statistic() const {
+    if (total_ == 0) {
+        return 0.;
+    }
+
+    double n = static_cast<double>(total_);
+    double bins = static_cast<double>(this->bins());
+    unsigned long long cumulative = 0;
+    double result = 0.;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+        cumulative += counts_[i];
+        double delta = std::abs(static_cast<double>(cumulative) / n - static_cast<double>(i + 1) / bins);
+        result = std::max(result, delta);
+    }
+
+    return result;
+}
+
+double Histogram::ks_p_value() const {
+    double d = ks_statistic();
+    if (d == 0.) {
+        return 1.;
+    }
+
+    double root = std::sqrt(static_cast<double>(total_));
+    double lambda = (root + 0.12 + 0.11 / root) * d;
+
+    // série alternée de la loi de Kolmogorov
+    double result = 0.;
+    double sign = 1.;
+    for (int j = 1; j <= 100; ++j) {
+        double term = sign * std::exp(-2. * j * j * lambda * lambda);
+        result += term;
+        if (std::abs(term) < 1e-12) {
+            break;
+        }
+        sign = -sign;
+    }
+
+    return std::clamp(2. * result, 0., 1.);
+}
+
+}
@@ -0,0 +1,189 @@
+/**
+ * @file histogram.hpp
+ * @author Andrew SASSOYE
+ */
+#ifndef DEV3_HISTOGRAM_HPP
+#define DEV3_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace g54327 {
+
+/**
+ * Histogramme de fréquences à compteurs 64 bits
+ *
+ * Chaque classe compte le nombre de tirages qui y sont tombés, le
+ * total reste exact bien au-delà des 4G tirages d'un compteur unsigned.
+ * Deux histogrammes de même nombre de classes se fusionnent par
+ * addition, ce qui permet de compter séparément dans chaque thread.
+ */
+class Histogram {
+    std::vector<unsigned long long> counts_;
+    unsigned long long total_;
+
+public:
+    /**
+     * Construit un histogramme vide
+     *
+     * @param bins nombre de classes
+     * @throw std::invalid_argument si bins est nul
+     */
+    explicit Histogram(std::size_t bins);
+
+    /**
+     * Compte un tirage dans la classe bin
+     *
+     * @param bin classe du tirage, strictement inférieure à bins()
+     */
+    inline void add(std::size_t bin);
+
+    /**
+     * Ajoute les compteurs de other à ceux de l'histogramme
+     *
+     * @param other histogramme de même nombre de classes
+     * @throw std::invalid_argument si les nombres de classes diffèrent
+     */
+    void merge(const Histogram &other);
+
+    inline std::size_t bins() const;
+
+    inline unsigned long long total() const;
+
+    inline unsigned long long count(std::size_t bin) const;
+
+    inline const std::vector<unsigned long long> &counts() const;
+
+    /**
+     * Retourne la fréquence observée d'une classe
+     *
+     * @param bin classe
+     * @return count(bin) / total(), 0 si l'histogramme est vide
+     */
+    double frequency(std::size_t bin) const;
+
+    /**
+     * Retourne la statistique du chi carré par rapport à la loi uniforme
+     *
+     * @return somme des (observé - attendu)^2 / attendu
+     */
+    double chi_square() const;
+
+    /**
+     * Retourne la p-valeur du chi carré à bins() - 1 degrés de liberté,
+     * approchée par la transformation de Wilson-Hilferty (très précise
+     * dès une dizaine de degrés de liberté)
+     *
+     * @return probabilité d'observer un chi carré au moins aussi grand
+     */
+    double chi_square_p_value() const;
+
+    /**
+     * Retourne la statistique de Kolmogorov-Smirnov par rapport à la loi
+     * uniforme discrète, soit le plus grand écart entre les fonctions de
+     * répartition observée et attendue
+     *
+     * @return écart maximal, entre 0 et 1
+     */
+    double ks_statistic() const;
+
+    /**
+     * Retourne la p-valeur asymptotique de Kolmogorov-Smirnov (avec la
+     * correction de Stephens). Pour une loi discrète le test est
+     * conservateur : la p-valeur est surestimée.
+     *
+     * @return probabilité d'observer un écart au moins aussi grand
+     */
+    double ks_p_value() const;
+};
+
+/**
+ * Remplit un histogramme de samples tirages uniformes dans [0, bins[
+ * répartis sur plusieurs threads
+ *
+ * Chaque thread possède son propre générateur, initialisé depuis seed et
+ * son numéro, et son propre histogramme, fusionnés à la fin. Aucun état
+ * n'est partagé pendant les tirages. Le résultat est reproductible pour
+ * un même triplet (seed, threads, samples).
+ *
+ * @tparam Engine générateur uniforme, construit à partir d'une std::seed_seq
+ * @param bins nombre de classes
+ * @param samples nombre total de tirages
+ * @param seed graine commune
+ * @param threads nombre de threads, 0 pour le nombre de cœurs
+ * @return l'histogramme fusionné
+ */
+template<typename Engine = std::mt19937_64>
+Histogram parallel_histogram(std::size_t bins, unsigned long long samples,
+                             unsigned long long seed = std::random_device{}(),
+                             unsigned threads = 0);
+
+// implémentation méthodes inline
+
+void Histogram::add(std::size_t bin) {
+    ++counts_[bin];
+    ++total_;
+}
+
+std::size_t Histogram::bins() const {
+    return counts_.size();
+}
+
+unsigned long long Histogram::total() const {
+    return total_;
+}
+
+unsigned long long Histogram::count(std::size_t bin) const {
+    return counts_[bin];
+}
+
+const std::vector<unsigned long long> &Histogram::counts() const {
+    return counts_;
+}
+
+template<typename Engine>
+Histogram parallel_histogram(std::size_t bins, unsigned long long samples,
+                             unsigned long long seed, unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<Histogram> partials(threads, Histogram{bins});
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (unsigned t = 0; t < threads; ++t) {
+        unsigned long long share = samples / threads + (t < samples % threads ? 1 : 0);
+        workers.emplace_back([&partial = partials[t], share, bins, seed, t]() {
+            std::seed_seq sequence{static_cast<unsigned>(seed), static_cast<unsigned>(seed >> 32), t};
+            Engine engine{sequence};
+            std::uniform_int_distribution<std::size_t> distribution{0, bins - 1};
+
+            // compteurs propres au thread : les partiels voisins dans
+            // partials partagent des lignes de cache
+            Histogram local{bins};
+            for (unsigned long long i = 0; i < share; ++i) {
+                local.add(distribution(engine));
+            }
+            partial = std::move(local);
+        });
+    }
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (unsigned t = 1; t < threads; ++t) {
+        partials[0].merge(partials[t]);
+    }
+
+    return std::move(partials[0]);
+}
+
+}
+
+#endif //DEV3_HISTOGRAM_HPP
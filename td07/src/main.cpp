@@ -6,6 +6,7 @@
 #include <iomanip>
 #include <algorithm>
 #include "td07.hpp"
+#include "histogram.hpp"
 #include "../resources/utilscpp.hpp"
 
 using namespace std;
@@ -38,6 +39,11 @@ void exe1() {
              << " (" << setprecision(2) << array[i].second * 100 << " %)"
              << endl;
     }
+
+    auto histogram = parallel_histogram(array.size(), 1000000);
+    cout << "en parallèle : " << histogram.total() << " tirages, chi carré = " << histogram.chi_square()
+         << " (p = " << histogram.chi_square_p_value() << "), KS = " << histogram.ks_statistic()
+         << " (p = " << histogram.ks_p_value() << ")" << endl;
 }
 
 void exe2() {
@@ -19,7 +19,7 @@
  * @return resultat statistique
  */
 template<size_t N>
-std::array<std::pair<unsigned, double>, N> test_nvs_random(unsigned times);
+std::array<std::pair<unsigned long long, double>, N> test_nvs_random(unsigned long long times);
 
 /**
  * Affiche le contenu d'un vector de int en console
@@ -41,15 +41,15 @@ unsigned primeFactor(std::map<unsigned, unsigned> &result, unsigned value);
 void printPrimeFactor(unsigned value, std::map<unsigned, unsigned> &decomposition);
 
 template<size_t N>
-std::array<std::pair<unsigned, double>, N> test_nvs_random(unsigned times) {
-    std::array<std::pair<unsigned, double>, N> array{};
+std::array<std::pair<unsigned long long, double>, N> test_nvs_random(unsigned long long times) {
+    std::array<std::pair<unsigned long long, double>, N> array{};
     size_t arraySize = array.size();
     size_t randomValue;
 
     nvs::randomize();
 
-    for (size_t i = 0; i < times; ++i) {
-        randomValue = nvs::random_value(0, arraySize);
+    for (unsigned long long i = 0; i < times; ++i) {
+        randomValue = nvs::random_value<size_t>(0, arraySize - 1);
         (array[randomValue].first)++;
     }
 
@@ -0,0 +1,51 @@
+#include "catch2/catch.hpp"
+#include "../src/histogram.hpp"
+
+#include <stdexcept>
+
+using namespace g54327;
+
+TEST_CASE("Histogram add / merge", "[add][merge]") {
+    Histogram lhs{4};
+    Histogram rhs{4};
+    lhs.add(0);
+    lhs.add(3);
+    rhs.add(3);
+    lhs.merge(rhs);
+
+    REQUIRE(lhs.total() == 3);
+    REQUIRE(lhs.count(0) == 1);
+    REQUIRE(lhs.count(3) == 2);
+    REQUIRE(lhs.frequency(1) == 0.);
+    REQUIRE_THROWS_AS(lhs.merge(Histogram{5}), std::invalid_argument);
+    REQUIRE_THROWS_AS(Histogram{0}, std::invalid_argument);
+}
+
+TEST_CASE("Histogram statistiques", "[chi_square][ks_statistic]") {
+    Histogram uniform{10};
+    for (int i = 0; i < 1000; ++i) {
+        uniform.add(i % 10);
+    }
+    REQUIRE(uniform.chi_square() == 0.);
+    REQUIRE(uniform.ks_statistic() == Approx(0.).margin(1e-12));
+    REQUIRE(uniform.ks_p_value() == 1.);
+
+    Histogram biased{10};
+    for (int i = 0; i < 1000; ++i) {
+        biased.add(i % 10 == 0 ? 1 : i % 10);
+    }
+    REQUIRE(biased.chi_square() == Approx(200.));
+    REQUIRE(biased.ks_statistic() == Approx(.1));
+    REQUIRE(biased.chi_square_p_value() < 1e-6);
+    REQUIRE(biased.ks_p_value() < 1e-6);
+}
+
+TEST_CASE("parallel_histogram", "[parallel_histogram]") {
+    auto histogram = parallel_histogram(16, 10000001, 42, 4);
+    REQUIRE(histogram.total() == 10000001);
+    REQUIRE(histogram.chi_square_p_value() > 1e-4);
+    REQUIRE(histogram.ks_p_value() > 1e-4);
+
+    auto again = parallel_histogram(16, 10000001, 42, 4);
+    REQUIRE(again.counts() == histogram.counts());
+}
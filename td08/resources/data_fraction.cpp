@@ -10,21 +10,24 @@ namespace nvs {
 
     std::vector<std::pair<int, int>> data_signed(unsigned size,
                                                  Random type) {
+        return data_signed(size, type == Random::REPRODUCTIBLE ?
+                                 seed{} : random_seed());
+    }
+
+    std::vector<std::pair<int, int>> data_signed(unsigned size,
+                                                 const seed &s) {
         using std::vector;
         using std::pair;
         using std::sqrt;
 
         vector<pair<int, int>> result(size);
-
-        if (type == Random::UNIQUE) {
-            nvs::randomize();
-        }
+        auto engine{urng(s)};
 
         int max{static_cast<int>(sqrt(size))};
         int min{-max};
         for (unsigned idx{0}; idx < size; ++idx) {
-            result[idx] = {nvs::random_value(min, max),
-                           nvs::random_value(min, max)
+            result[idx] = {random_value(min, max, engine),
+                           random_value(min, max, engine)
             };
         }
 
@@ -33,21 +36,24 @@ namespace nvs {
 
     std::vector<std::tuple<int, unsigned, unsigned>> data_unsigned(
             unsigned size, Random type) {
+        return data_unsigned(size, type == Random::REPRODUCTIBLE ?
+                                   seed{} : random_seed());
+    }
+
+    std::vector<std::tuple<int, unsigned, unsigned>> data_unsigned(
+            unsigned size, const seed &s) {
         using std::vector;
         using std::tuple;
         using std::sqrt;
 
         vector<tuple<int, unsigned, unsigned>> result(size);
-
-        if (type == Random::UNIQUE) {
-            nvs::randomize();
-        }
+        auto engine{urng(s)};
 
         unsigned max{static_cast<unsigned>(sqrt(size))};
         for (unsigned idx{0}; idx < size; ++idx) {
-            result[idx] = {nvs::random_value(-1, 1),
-                           nvs::random_value(0u, max),
-                           nvs::random_value(0u, max)
+            result[idx] = {random_value(-1, 1, engine),
+                           random_value(0u, max, engine),
+                           random_value(0u, max, engine)
             };
         }
 
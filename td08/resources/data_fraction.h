@@ -11,6 +11,8 @@
 #include <utility>
 #include <tuple>
 
+#include "random.hpp"
+
 namespace nvs {
 
 /*!
@@ -50,6 +52,23 @@ namespace nvs {
     std::vector<std::pair<int, int>>
     data_signed(unsigned size = 1'000'000, Random type = Random::UNIQUE);
 
+/*!
+ * \brief Variante de data_signed à partir d'une graine explicite.
+ *
+ * Les valeurs sont tirées d'un générateur propre à l'appel,
+ * déterminé par `s`, et non du générateur partagé de nvs::urng() :
+ * le résultat est le même quels que soient les autres threads.
+ * Random::REPRODUCTIBLE correspond à la graine par défaut seed{},
+ * Random::UNIQUE à une graine tirée de nvs::random_seed().
+ *
+ * \param size le nombre de std::pair à produire.
+ * \param s graine et numéro de flux.
+ *
+ * \return std::vector de `size` std::pair.
+ */
+    std::vector<std::pair<int, int>>
+    data_signed(unsigned size, const seed &s);
+
 /*!
  * \brief Fonction pour la génération de fraction avec un signe et
  *       deux entiers non signés en argument.
@@ -72,6 +91,19 @@ namespace nvs {
     std::vector<std::tuple<int, unsigned, unsigned>>
     data_unsigned(unsigned size = 1'000'000, Random type = Random::UNIQUE);
 
+/*!
+ * \brief Variante de data_unsigned à partir d'une graine explicite.
+ *
+ * Voir data_signed(unsigned, const seed &).
+ *
+ * \param size le nombre de std::tuple à produire.
+ * \param s graine et numéro de flux.
+ *
+ * \return std::vector de `size` std::tuple.
+ */
+    std::vector<std::tuple<int, unsigned, unsigned>>
+    data_unsigned(unsigned size, const seed &s);
+
 }
 
 #endif // DATA_FRACTION_H
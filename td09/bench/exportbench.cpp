@@ -0,0 +1,69 @@
+/**
+ * @file exportbench.cpp
+ * @brief Mesure du débit d'exportation textuelle d'un Lotto.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace g54327::lotto;
+
+/*!
+ * \brief Durée d'exécution d'une fonction, en secondes.
+ */
+template<typename Function>
+double measure(Function function) {
+  auto start{std::chrono::steady_clock::now()};
+  function();
+  std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+  return elapsed.count();
+}
+
+/*!
+ * \brief Exporte un lotto de `argv[1]` pronostics (10 millions par
+ *        défaut) vers `argv[2]` (`/dev/null` par défaut), une fois
+ *        par to_string() et une fois par l'opérateur d'injection.
+ */
+int main(int argc, char *argv[]) {
+  const unsigned count{argc > 1
+                       ? static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10))
+                       : 10'000'000u};
+  const std::string path{argc > 2 ? argv[2] : "/dev/null"};
+
+  Lotto lotto{6, 45, 1};
+  auto columns{nvs::lotto::data(count, 6, 45, 1, nvs::seed{})};
+  for (std::size_t i{0}; i < columns.size(); ++i) {
+    lotto.add(columns.owners[columns.owner[i]],
+              std::vector<unsigned>(columns.grid(i),
+                                    columns.grid(i) + columns.length));
+  }
+  lotto.set_draw();
+
+  std::size_t bytes{0};
+  double string_time{measure([&]() {
+    std::ofstream out{path, std::ios::binary};
+    auto text{lotto.to_string()};
+    bytes = text.size();
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+  })};
+  double stream_time{measure([&]() {
+    std::ofstream out{path, std::ios::binary};
+    out << lotto;
+  })};
+
+  const double megabytes{static_cast<double>(bytes) / 1e6};
+  std::cout << count << " pronostics, " << megabytes << " Mo\n"
+            << "to_string  : " << string_time << " s, "
+            << megabytes / string_time << " Mo/s\n"
+            << "operator<< : " << stream_time << " s, "
+            << megabytes / stream_time << " Mo/s\n";
+}
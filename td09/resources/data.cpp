@@ -2,25 +2,40 @@
 #include <utility>
 #include <string>
 #include <stdexcept>
-#include <numeric>
 #include <algorithm>
 #include <iterator>
 
+#include "data.h"
 #include "random.hpp"
+#include "../src/parallel.hpp"
 
 namespace nvs {
 
 namespace lotto {
 
-std::vector<std::pair<std::string, std::vector<unsigned>>>
-data(unsigned pronostic_count, unsigned grid_length,
-     unsigned grid_maximum, unsigned grid_minimum) {
+namespace {
+
+/*!
+ * \brief Nombre de pronostics d'un bloc de production.
+ */
+constexpr std::size_t CHUNK_SIZE{1u << 14};
+
+/*!
+ * \brief Écart entre les positions de départ de deux blocs
+ *        successifs dans le flux du générateur.
+ */
+constexpr unsigned long long CHUNK_STRIDE{1ull << 40};
+
+void check(unsigned grid_length, unsigned grid_maximum,
+           unsigned grid_minimum) {
   if (grid_length == 0 ||
       grid_maximum < grid_minimum ||
       grid_maximum - grid_minimum + 1 < grid_length) {
     throw std::invalid_argument{"boom !"};
   }
+}
 
+const std::vector<std::string> &owners() {
   static const std::vector<std::string> owner
       {
           "38708", "39238", "39864", "41298", "41326", "41949", "42176",
@@ -36,28 +51,70 @@ data(unsigned pronostic_count, unsigned grid_length,
           "49853", "49869", "49877", "49921", "49923", "51395", "51426",
           "51531", "51594", "51603", "51885", "53785",
       };
+  return owner;
+}
+
+} // namespace
+
+std::vector<std::pair<std::string, std::vector<unsigned>>>
+data(unsigned pronostic_count, unsigned grid_length,
+     unsigned grid_maximum, unsigned grid_minimum) {
+  check(grid_length, grid_maximum, grid_minimum);
+
+  const auto &owner{owners()};
   static const unsigned owner_last_index
       {static_cast<unsigned>(owner.size()) - 1};
 
-  std::vector<unsigned> pronostic(grid_maximum - grid_minimum + 1);
-  std::iota(std::begin(pronostic), std::end(pronostic),
-            grid_minimum);
-
   decltype(data(0, 0, 0, 0)) result(pronostic_count);
 
   for (std::size_t i{0}; i < pronostic_count; ++i) {
     result[i].first = owner[nvs::random_value(0u, owner_last_index)];
-
-    std::shuffle(std::begin(pronostic), std::end(pronostic),
-                 nvs::urng());
-    result[i].second = {std::cbegin(pronostic),
-                        std::cbegin(pronostic) + grid_length
-    };
+    result[i].second = nvs::random_sample(grid_length, grid_minimum,
+                                          grid_maximum);
   }
 
   return result;
 }
 
+PronosticColumns
+data(unsigned pronostic_count, unsigned grid_length,
+     unsigned grid_maximum, unsigned grid_minimum,
+     const seed &s, unsigned threads) {
+  check(grid_length, grid_maximum, grid_minimum);
+
+  PronosticColumns result{grid_length, owners(), {}, {}};
+  result.owner.resize(pronostic_count);
+  result.values.resize(std::size_t{pronostic_count} * grid_length);
+
+  const unsigned owner_last_index
+      {static_cast<unsigned>(result.owners.size()) - 1};
+  const std::size_t chunks
+      {(pronostic_count + CHUNK_SIZE - 1) / CHUNK_SIZE};
+
+  // blocs de même coût : une plage contiguë de blocs par thread
+  g54327::lotto::parallel_for(
+      chunks, threads,
+      [&](unsigned, std::size_t first_chunk, std::size_t last_chunk) {
+        for (auto chunk{first_chunk}; chunk < last_chunk; ++chunk) {
+          auto engine{urng(s)};
+          engine.discard(chunk * CHUNK_STRIDE);
+
+          std::size_t first{chunk * CHUNK_SIZE};
+          std::size_t last{std::min<std::size_t>(first + CHUNK_SIZE,
+                                                 pronostic_count)};
+          for (std::size_t i{first}; i < last; ++i) {
+            result.owner[i] = static_cast<std::uint16_t>(
+                random_value(0u, owner_last_index, engine));
+            auto grid{std::begin(result.values) + i * grid_length};
+            fill_sample(grid, grid + grid_length, grid_minimum,
+                        grid_maximum, engine);
+          }
+        }
+      });
+
+  return result;
+}
+
 } // namespace lotto
 
 } // namespace nvs
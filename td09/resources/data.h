@@ -9,6 +9,10 @@
 #include <vector>
 #include <utility>
 #include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "random.hpp"
 
 /*!
  * \brief Espace de nom de Nicolas Vansteenkiste.
@@ -54,6 +58,91 @@ std::vector<std::pair<std::string, std::vector<unsigned>>>
 data(unsigned pronostic_count, unsigned grid_length,
      unsigned grid_maximum, unsigned grid_minimum);
 
+/*!
+ * \brief Pronostics produits par colonnes.
+ *
+ * Plutôt qu'un std::vector de std::pair, les données sont rangées
+ * dans deux tampons contigus :
+ *
+ *    + `owner` contient, pour chaque pronostic, l'indice de son
+ *      propriétaire dans le dictionnaire `owners` ;
+ *    + `values` contient les valeurs des pronostics les unes à la
+ *      suite des autres, `length` valeurs triées par pronostic.
+ */
+struct PronosticColumns {
+  /*!
+   * \brief Nombre de valeurs d'un pronostic.
+   */
+  unsigned length;
+
+  /*!
+   * \brief Dictionnaire des propriétaires.
+   */
+  std::vector<std::string> owners;
+
+  /*!
+   * \brief Indice du propriétaire de chaque pronostic dans
+   *        `owners`.
+   */
+  std::vector<std::uint16_t> owner;
+
+  /*!
+   * \brief Valeurs des pronostics, `length` par pronostic.
+   */
+  std::vector<unsigned> values;
+
+  /*!
+   * \brief Nombre de pronostics.
+   *
+   * \return le nombre de pronostics.
+   */
+  std::size_t size() const {
+    return owner.size();
+  }
+
+  /*!
+   * \brief Valeurs d'un pronostic.
+   *
+   * \param index indice du pronostic.
+   *
+   * \return pointeur vers les `length` valeurs du pronostic.
+   */
+  const unsigned *grid(std::size_t index) const {
+    return values.data() + index * length;
+  }
+};
+
+/*!
+ * \brief Fonction parallèle de production de pronostics pour un
+ *        jeu de lotto.
+ *
+ * Les pronostics sont produits par blocs de taille fixe répartis
+ * entre `threads` threads. Chaque bloc tire ses valeurs d'un
+ * nvs::philox4x32 propre, placé dans le flux de `s` à une position
+ * qui ne dépend que du numéro du bloc : le résultat ne dépend donc
+ * que de `s`, ni du nombre de threads ni de leur ordonnancement.
+ * Chaque grille est tirée par nvs::fill_sample, en O(`grid_length`),
+ * directement dans le tampon préalloué.
+ *
+ * \param pronostic_count nombre de pronostics désirés.
+ * \param grid_length nombre de valeurs dans un pronostic.
+ * \param grid_maximum valeur maximale possible des valeurs du
+ *                     pronostic.
+ * \param grid_minimum valeur minimale possible des valeurs du
+ *                     pronostic.
+ * \param s graine et numéro de flux.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ *
+ * \return les pronostics rangés par colonnes.
+ *
+ * \throw std::invalid_argument dans les mêmes cas que
+ *        data(unsigned, unsigned, unsigned, unsigned).
+ */
+PronosticColumns
+data(unsigned pronostic_count, unsigned grid_length,
+     unsigned grid_maximum, unsigned grid_minimum,
+     const seed &s, unsigned threads = 0);
+
 } // namespace lotto
 
 } // namespace nvs
@@ -0,0 +1,390 @@
+/**
+ * @file coverage.hpp
+ * @brief Définition de la classe g54327::lotto::CoverageTable.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef COVERAGE_H
+#define COVERAGE_H
+
+#include "dedup.hpp"
+#include "grid.hpp"
+#include "parallel.hpp"
+#include "parameter.hpp"
+
+#include <array>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Tables de couverture des sous-ensembles de valeurs
+ *        joués par un ensemble de pronostics.
+ *
+ * Pour chaque taille `j` de 1 à la taille d'une grille, la table
+ * du niveau `j` associe à chaque sous-ensemble de `j` valeurs le
+ * nombre de pronostics qui le contiennent. Pour un tirage `D`,
+ * soit `c(j)` la somme de ces nombres sur les sous-ensembles de
+ * `j` valeurs de `D` : un pronostic ayant `m` valeurs communes
+ * avec `D` y est compté C(`m`, `j`) fois. Le nombre `h(k)` de
+ * pronostics ayant exactement `k` valeurs communes s'en déduit
+ * par inclusion-exclusion :
+ *
+ *     h(k) = somme pour j de k à length de
+ *            (-1)^(j - k) C(j, k) c(j)
+ *
+ * Un histogramme coûte donc 2^length consultations de tables,
+ * quel que soit le nombre de pronostics : on peut en calculer un
+ * pour chaque tirage possible, avant le tirage.
+ *
+ * Un niveau dont le nombre de sous-ensembles possibles est
+ * raisonnable est un tableau indicé par le rang du sous-ensemble
+ * dans le système combinatoire ; les autres sont des tables de
+ * hachage indexées par le masque du sous-ensemble. Seules les
+ * grilles en masque sont prises en charge.
+ */
+class CoverageTable {
+ public:
+  /*!
+   * \brief Taille maximale d'une grille : une grille a
+   *        2^length sous-ensembles.
+   */
+  static constexpr unsigned MAX_LENGTH_{16};
+
+  /*!
+   * \brief Nombre maximal de cases d'un niveau en tableau.
+   */
+  static constexpr unsigned long long DENSE_LIMIT_{1ull << 22};
+
+ private:
+  /*!
+   * \brief Foncteur de hachage d'un masque.
+   */
+  struct MaskHash {
+    std::size_t operator()(const Grid::mask_type &mask) const {
+      return static_cast<std::size_t>(hash(mask));
+    }
+  };
+
+  /*!
+   * \brief Paramétrage des grilles.
+   */
+  Parameter parameter_;
+
+  /*!
+   * \brief Nombre de pronostics couverts.
+   */
+  std::size_t pronostics_;
+
+  /*!
+   * \brief Coefficients binomiaux C(n, k), `binomials_[n][k]`,
+   *        pour n jusqu'au nombre de valeurs possibles et k
+   *        jusqu'à la taille d'une grille.
+   */
+  std::vector<std::vector<unsigned long long>> binomials_;
+
+  /*!
+   * \brief Sous-ensembles d'indices d'une grille, en bits, par
+   *        taille.
+   */
+  std::vector<std::vector<std::uint32_t>> subsets_;
+
+  /*!
+   * \brief Niveaux en tableau, indicés par taille ; vide pour un
+   *        niveau haché.
+   */
+  std::vector<std::vector<std::uint32_t>> dense_;
+
+  /*!
+   * \brief Niveaux hachés, indicés par taille ; vide pour un
+   *        niveau en tableau.
+   */
+  std::vector<std::unordered_map<Grid::mask_type, std::uint32_t,
+                                 MaskHash>> hashed_;
+
+  /*!
+   * \brief Rang d'un sous-ensemble dans le système combinatoire.
+   *
+   * \param values valeurs triées d'une grille.
+   * \param subset indices des valeurs du sous-ensemble, en bits.
+   *
+   * \return somme des C(`values[i] - minimum`, rang de `i`).
+   */
+  inline unsigned long long rank(const unsigned *values,
+                                 std::uint32_t subset) const;
+
+  /*!
+   * \brief Masque d'un sous-ensemble.
+   *
+   * \param values valeurs triées d'une grille.
+   * \param subset indices des valeurs du sous-ensemble, en bits.
+   *
+   * \return masque des valeurs du sous-ensemble.
+   */
+  static inline Grid::mask_type mask(const unsigned *values,
+                                     std::uint32_t subset);
+
+  /*!
+   * \brief Nombre de pronostics contenant un sous-ensemble.
+   *
+   * \param level taille du sous-ensemble, au moins 1.
+   * \param values valeurs triées d'une grille.
+   * \param subset indices des valeurs du sous-ensemble, en bits.
+   *
+   * \return nombre de pronostics contenant ces valeurs.
+   */
+  inline std::uint32_t lookup(unsigned level, const unsigned *values,
+                              std::uint32_t subset) const;
+
+ public:
+
+  /*!
+   * \brief Construction des tables.
+   *
+   * Chaque grille distincte est décomposée en ses sous-ensembles,
+   * chacun comptant pour sa multiplicité. Les niveaux sont
+   * répartis entre les threads, chaque niveau étant rempli par un
+   * seul thread.
+   *
+   * \param distinct grilles distinctes des pronostics.
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \throw std::invalid_argument si les grilles ne tiennent pas
+   *          dans un masque ou ont plus de \ref MAX_LENGTH_
+   *          valeurs.
+   */
+  inline explicit CoverageTable(const DistinctGrids &distinct,
+                                unsigned threads = 0);
+
+  /*!
+   * \brief Accesseur en lecture du paramétrage.
+   *
+   * \return paramétrage des grilles.
+   */
+  inline const Parameter &parameter() const;
+
+  /*!
+   * \brief Nombre de pronostics couverts.
+   *
+   * \return nombre de pronostics.
+   */
+  inline std::size_t size() const;
+
+  /*!
+   * \brief Rangement d'un niveau.
+   *
+   * \param level taille des sous-ensembles, de 1 à la taille
+   *              d'une grille.
+   *
+   * \return `true` si le niveau est un tableau, `false` s'il est
+   *         haché.
+   */
+  inline bool dense(unsigned level) const;
+
+  /*!
+   * \brief Nombre de pronostics contenant toutes les valeurs d'une
+   *        grille.
+   *
+   * \param subset valeurs recherchées, au plus la taille d'une
+   *               grille.
+   *
+   * \return nombre de pronostics contenant `subset` ; tous pour
+   *         une grille vide, aucun si `subset` a trop de valeurs
+   *         ou une valeur hors paramétrage.
+   */
+  inline std::size_t count(const Grid &subset) const;
+
+  /*!
+   * \brief Répartition des pronostics selon leur nombre de valeurs
+   *        communes avec un tirage candidat.
+   *
+   * Même résultat que Lotto::match_histogram() si `draw` était le
+   * tirage, par consultation des tables seulement.
+   *
+   * \param draw tirage candidat.
+   *
+   * \return nombre de pronostics par nombre de valeurs communes,
+   *         de 0 à la taille d'une grille.
+   *
+   * \throw std::invalid_argument si `draw` n'a pas la taille d'une
+   *          grille ou a une valeur hors paramétrage.
+   */
+  inline std::vector<unsigned long long>
+  match_histogram(const Grid &draw) const;
+};
+
+// implémentation méthodes inline
+
+CoverageTable::CoverageTable(const DistinctGrids &distinct,
+                             unsigned threads) :
+    parameter_{distinct.parameter()},
+    pronostics_{distinct.pronostic_count()},
+    binomials_{},
+    subsets_{},
+    dense_{},
+    hashed_{} {
+  const unsigned length{parameter_.length()};
+  if (!distinct.bitmask()) {
+    throw std::invalid_argument{"coverage bitmask error"};
+  }
+  if (length > MAX_LENGTH_) {
+    throw std::invalid_argument{"coverage length error"};
+  }
+  const unsigned values{parameter_.maximum() - parameter_.minimum() + 1};
+  binomials_.assign(values + 1,
+                    std::vector<unsigned long long>(length + 1));
+  for (unsigned n{0}; n <= values; ++n) {
+    binomials_[n][0] = 1;
+    for (unsigned k{1}; k <= std::min(n, length); ++k) {
+      // saturé : seul compte le fait de dépasser DENSE_LIMIT_
+      auto sum{binomials_[n - 1][k - 1] + binomials_[n - 1][k]};
+      binomials_[n][k] = sum < binomials_[n - 1][k]
+                         ? std::numeric_limits<unsigned long long>::max()
+                         : sum;
+    }
+  }
+
+  subsets_.assign(length + 1, {});
+  for (std::uint32_t subset{1}; subset >> length == 0; ++subset) {
+    subsets_[popcount(subset)].push_back(subset);
+  }
+
+  dense_.assign(length + 1, {});
+  hashed_.assign(length + 1, {});
+  std::atomic<unsigned> next_level{1};
+  // niveaux distribués à la demande : leur coût croît avec le niveau
+  run_threads(std::min(thread_count(threads), std::max(1u, length)),
+              [&](unsigned) {
+    std::vector<unsigned> grid(length);
+    for (unsigned level; (level = next_level++) <= length;) {
+      const bool is_dense{binomials_[values][level] <= DENSE_LIMIT_};
+      if (is_dense) {
+        dense_[level].assign(binomials_[values][level], 0);
+      } else {
+        hashed_[level].reserve(std::min<std::size_t>(
+            distinct.size() * subsets_[level].size(),
+            binomials_[values][level]));
+      }
+      for (std::size_t d{0}; d < distinct.size(); ++d) {
+        auto multiplicity{
+            static_cast<std::uint32_t>(distinct.multiplicity(d))};
+        auto current{distinct.grid(d)};
+        std::copy(current.begin(), current.end(), std::begin(grid));
+        for (auto subset : subsets_[level]) {
+          if (is_dense) {
+            dense_[level][rank(grid.data(), subset)] += multiplicity;
+          } else {
+            hashed_[level][mask(grid.data(), subset)] += multiplicity;
+          }
+        }
+      }
+    }
+  });
+}
+
+unsigned long long CoverageTable::rank(const unsigned *values,
+                                       std::uint32_t subset) const {
+  unsigned long long result{0};
+  for (unsigned k{1}; subset != 0; ++k, subset &= subset - 1) {
+    auto i{popcount((subset & (0 - subset)) - 1)};
+    result += binomials_[values[i] - parameter_.minimum()][k];
+  }
+  return result;
+}
+
+Grid::mask_type CoverageTable::mask(const unsigned *values,
+                                    std::uint32_t subset) {
+  Grid::mask_type result{};
+  for (; subset != 0; subset &= subset - 1) {
+    auto value{values[popcount((subset & (0 - subset)) - 1)]};
+    result[value / 64] |= std::uint64_t{1} << value % 64;
+  }
+  return result;
+}
+
+std::uint32_t CoverageTable::lookup(unsigned level, const unsigned *values,
+                                    std::uint32_t subset) const {
+  if (!dense_[level].empty()) {
+    return dense_[level][rank(values, subset)];
+  }
+  auto position{hashed_[level].find(mask(values, subset))};
+  return position == std::end(hashed_[level]) ? 0 : position->second;
+}
+
+const Parameter &CoverageTable::parameter() const {
+  return parameter_;
+}
+
+std::size_t CoverageTable::size() const {
+  return pronostics_;
+}
+
+bool CoverageTable::dense(unsigned level) const {
+  return !dense_[level].empty();
+}
+
+std::size_t CoverageTable::count(const Grid &subset) const {
+  const auto level{subset.size()};
+  if (level == 0) {
+    return pronostics_;
+  }
+  if (level > parameter_.length()
+      || *subset.begin() < parameter_.minimum()
+      || *subset.rbegin() > parameter_.maximum()) {
+    return 0;
+  }
+  std::vector<unsigned> values(subset.begin(), subset.end());
+  return lookup(static_cast<unsigned>(level), values.data(),
+                (std::uint32_t{1} << level) - 1);
+}
+
+std::vector<unsigned long long>
+CoverageTable::match_histogram(const Grid &draw) const {
+  const unsigned length{parameter_.length()};
+  if (draw.size() != length) {
+    throw std::invalid_argument{"size error"};
+  }
+  if (*draw.begin() < parameter_.minimum()
+      || *draw.rbegin() > parameter_.maximum()) {
+    throw std::invalid_argument{"value error"};
+  }
+
+  std::vector<unsigned> values(draw.begin(), draw.end());
+  // c(j) : somme des couvertures des sous-ensembles de j valeurs
+  std::vector<long long> sums(length + 1);
+  sums[0] = static_cast<long long>(pronostics_);
+  for (unsigned j{1}; j <= length; ++j) {
+    for (auto subset : subsets_[j]) {
+      sums[j] += lookup(j, values.data(), subset);
+    }
+  }
+
+  std::vector<unsigned long long> result(length + 1);
+  for (unsigned k{0}; k <= length; ++k) {
+    long long h{0};
+    for (unsigned j{k}; j <= length; ++j) {
+      // C(j, k) : les lignes de binomials_ s'arrêtent au nombre de
+      // valeurs possibles, qui est au moins length
+      auto term{static_cast<long long>(binomials_[j][k]) * sums[j]};
+      h += (j - k) % 2 == 0 ? term : -term;
+    }
+    result[k] = static_cast<unsigned long long>(h);
+  }
+  return result;
+}
+
+}
+
+#endif // COVERAGE_H
@@ -0,0 +1,563 @@
+/**
+ * @file dedup.hpp
+ * @brief Définition de la classe g54327::lotto::DistinctGrids.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef DEDUP_H
+#define DEDUP_H
+
+#include "grid.hpp"
+#include "parameter.hpp"
+#include "preset.hpp"
+#include "parallel.hpp"
+#include "store.hpp"
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <unordered_map>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Bilan du dédoublonnage d'un ensemble de pronostics.
+ */
+struct DedupStats {
+  /*!
+   * \brief Nombre de pronostics.
+   */
+  std::size_t pronostics;
+
+  /*!
+   * \brief Nombre de grilles distinctes.
+   */
+  std::size_t distinct;
+
+  /*!
+   * \brief Plus grand nombre de pronostics d'une même grille.
+   */
+  std::size_t max_multiplicity;
+
+  /*!
+   * \brief Nombre de pronostics en double.
+   *
+   * \return `pronostics - distinct`.
+   */
+  std::size_t duplicates() const {
+    return pronostics - distinct;
+  }
+
+  /*!
+   * \brief Taux de dédoublonnage.
+   *
+   * \return nombre moyen de pronostics par grille distincte, 1 si
+   *         aucune grille n'est en double ou s'il n'y a pas de
+   *         pronostic.
+   */
+  double ratio() const {
+    return distinct == 0 ? 1.0 : static_cast<double>(pronostics)
+                                     / static_cast<double>(distinct);
+  }
+};
+
+/*!
+ * \brief Grilles distinctes d'un ensemble de pronostics.
+ *
+ * Chaque grille n'y apparaît qu'une fois, rangée par colonnes
+ * comme dans PronosticStore, dans l'ordre de son premier
+ * pronostic. Pour chacune sont conservés, par indices croissants,
+ * les pronostics qui la jouent et leurs propriétaires. La
+ * comparaison à un tirage ne se fait donc qu'une fois par grille
+ * distincte, son résultat comptant pour tous ses pronostics.
+ *
+ * Les grilles sont regroupées par une table de hachage de leur
+ * forme canonique : le masque, ou les valeurs triées si la grille
+ * ne tient pas dans un masque. L'ensemble ne suit pas les ajouts
+ * ultérieurs au PronosticStore dont il est issu.
+ */
+class DistinctGrids {
+  /*!
+   * \brief Marque d'une grille locale sans successeur dans sa
+   *        chaîne de collisions.
+   */
+  static constexpr std::uint32_t NONE_
+      {std::numeric_limits<std::uint32_t>::max()};
+
+  /*!
+   * \brief Paramétrage commun à toutes les grilles.
+   */
+  Parameter parameter_;
+
+  /*!
+   * \brief Masques des grilles distinctes, si elles tiennent dans
+   *        un masque.
+   */
+  std::vector<Grid::mask_type> masks_;
+
+  /*!
+   * \brief Valeurs triées des grilles distinctes,
+   *        `parameter_.length()` par grille, sinon.
+   */
+  std::vector<unsigned> values_;
+
+  /*!
+   * \brief Début, dans \ref pronostics_, des pronostics de chaque
+   *        grille distincte, suivi du nombre total de pronostics.
+   */
+  std::vector<std::size_t> offsets_;
+
+  /*!
+   * \brief Indices des pronostics, groupés par grille distincte.
+   */
+  std::vector<std::size_t> pronostics_;
+
+  /*!
+   * \brief Propriétaire de chaque pronostic de \ref pronostics_.
+   */
+  std::vector<std::uint32_t> owner_ids_;
+
+  /*!
+   * \brief Grille distincte de chaque pronostic, par indice de
+   *        pronostic.
+   */
+  std::vector<std::uint32_t> groups_;
+
+  /*!
+   * \brief Empreinte de la grille d'un pronostic.
+   *
+   * \param store ensemble de pronostics.
+   * \param index indice du pronostic.
+   *
+   * \return empreinte de 64 bits de la forme canonique de la
+   *         grille.
+   */
+  static inline std::uint64_t hash(const PronosticStore &store,
+                                   std::size_t index);
+
+  /*!
+   * \brief Égalité des grilles de deux pronostics.
+   *
+   * \param store ensemble de pronostics.
+   * \param lhs indice du premier pronostic.
+   * \param rhs indice du second pronostic.
+   *
+   * \return `true` si les deux pronostics jouent la même grille.
+   */
+  static inline bool same(const PronosticStore &store,
+                          std::size_t lhs, std::size_t rhs);
+
+ public:
+
+  /*!
+   * \brief Dédoublonnage des grilles d'un ensemble de pronostics.
+   *
+   * La construction se fait en trois temps :
+   *
+   *  + les empreintes des grilles sont calculées en parallèle,
+   *    par plages contiguës, puis les indices sont répartis entre
+   *    threads selon leur empreinte ;
+   *  + chaque thread regroupe les grilles dont l'empreinte lui
+   *    revient, dans sa propre table : une grille et ses doubles,
+   *    de même empreinte, sont traités par le même thread ;
+   *  + les groupes locaux sont numérotés dans l'ordre de leur
+   *    premier pronostic.
+   *
+   * Le résultat ne dépend donc pas du nombre de threads.
+   *
+   * \param store ensemble de pronostics.
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   */
+  inline explicit DistinctGrids(const PronosticStore &store,
+                                unsigned threads = 0);
+
+  /*!
+   * \brief Accesseur en lecture du paramétrage.
+   *
+   * \return paramétrage des grilles.
+   */
+  inline const Parameter &parameter() const;
+
+  /*!
+   * \brief Nombre de grilles distinctes.
+   *
+   * \return nombre de grilles distinctes.
+   */
+  inline std::size_t size() const;
+
+  /*!
+   * \brief Nombre de pronostics dédoublonnés.
+   *
+   * \return taille du PronosticStore d'origine.
+   */
+  inline std::size_t pronostic_count() const;
+
+  /*!
+   * \brief Rangement des grilles en masque.
+   *
+   * \return `true` si les grilles sont rangées dans masks(),
+   *         `false` si elles le sont dans values().
+   */
+  inline bool bitmask() const;
+
+  /*!
+   * \brief Masques contigus des grilles distinctes.
+   *
+   * \return les masques, vide si bitmask() est faux.
+   */
+  inline const std::vector<Grid::mask_type> &masks() const;
+
+  /*!
+   * \brief Valeurs contiguës des grilles distinctes.
+   *
+   * \return les valeurs, vide si bitmask() est vrai.
+   */
+  inline const std::vector<unsigned> &values() const;
+
+  /*!
+   * \brief Reconstruction d'une grille distincte.
+   *
+   * \param index indice de la grille distincte.
+   *
+   * \return la grille.
+   */
+  inline Grid grid(std::size_t index) const;
+
+  /*!
+   * \brief Nombre de pronostics d'une grille distincte.
+   *
+   * \param index indice de la grille distincte.
+   *
+   * \return nombre de pronostics jouant cette grille, au moins 1.
+   */
+  inline std::size_t multiplicity(std::size_t index) const;
+
+  /*!
+   * \brief Pronostics d'une grille distincte.
+   *
+   * \param index indice de la grille distincte.
+   *
+   * \return pointeur vers les multiplicity() indices croissants
+   *         des pronostics jouant cette grille.
+   */
+  inline const std::size_t *pronostics(std::size_t index) const;
+
+  /*!
+   * \brief Propriétaires d'une grille distincte.
+   *
+   * \param index indice de la grille distincte.
+   *
+   * \return pointeur vers les multiplicity() identifiants des
+   *         propriétaires, dans l'ordre de pronostics().
+   */
+  inline const std::uint32_t *owner_ids(std::size_t index) const;
+
+  /*!
+   * \brief Grille distincte d'un pronostic.
+   *
+   * \param pronostic indice du pronostic.
+   *
+   * \return indice de la grille distincte qu'il joue.
+   */
+  inline std::size_t group(std::size_t pronostic) const;
+
+  /*!
+   * \brief Bilan du dédoublonnage.
+   *
+   * \return nombres de pronostics et de grilles distinctes, plus
+   *         grande multiplicité.
+   */
+  inline DedupStats stats() const;
+
+  /*!
+   * \brief Nombre de valeurs communes à une grille distincte et à
+   *        une grille donnée.
+   *
+   * \param index indice de la grille distincte.
+   * \param grid grille à comparer.
+   *
+   * \return nombre de valeurs communes.
+   */
+  inline unsigned matches(std::size_t index, const Grid &grid) const;
+
+  /*!
+   * \brief Répartition des pronostics selon leur nombre de valeurs
+   *        communes avec un tirage.
+   *
+   * Même résultat que Lotto::match_histogram(), mais chaque grille
+   * distincte n'est comparée qu'une fois et compte pour
+   * multiplicity() pronostics.
+   *
+   * \param draw grille du tirage.
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return nombre de pronostics par nombre de valeurs communes,
+   *         de 0 à la taille d'une grille.
+   */
+  inline std::vector<unsigned long long>
+  match_histogram(const Grid &draw, unsigned threads = 0) const;
+};
+
+// implémentation méthodes inline
+
+DistinctGrids::DistinctGrids(const PronosticStore &store,
+                             unsigned threads) :
+    parameter_{store.parameter()},
+    masks_{},
+    values_{},
+    offsets_{},
+    pronostics_{},
+    owner_ids_{},
+    groups_(store.size()) {
+  threads = thread_count(threads);
+
+  const std::size_t size{store.size()};
+  std::vector<std::uint64_t> hashes(size);
+  parallel_for(size, threads,
+               [&](unsigned, std::size_t first, std::size_t last) {
+    for (auto i{first}; i < last; ++i) {
+      hashes[i] = hash(store, i);
+    }
+  });
+
+  // les bits de poids fort choisissent le thread, ceux de poids
+  // faible le seau de la table
+  auto owner{[threads](std::uint64_t hash) {
+    return static_cast<unsigned>((hash >> 32) % threads);
+  }};
+
+  // indices regroupés par thread (comptage puis répartition), dans
+  // l'ordre croissant au sein de chaque thread : chacun ne lit que
+  // sa part
+  std::vector<std::size_t> bucket_offsets(threads + 1);
+  for (std::size_t i{0}; i < size; ++i) {
+    ++bucket_offsets[owner(hashes[i]) + 1];
+  }
+  for (unsigned t{0}; t < threads; ++t) {
+    bucket_offsets[t + 1] += bucket_offsets[t];
+  }
+  std::vector<std::size_t> buckets(size);
+  {
+    std::vector<std::size_t> positions(std::begin(bucket_offsets),
+                                       std::end(bucket_offsets) - 1);
+    for (std::size_t i{0}; i < size; ++i) {
+      buckets[positions[owner(hashes[i])]++] = i;
+    }
+  }
+
+  // groupe local, dans l'ordre croissant des pronostics, et
+  // premier pronostic de chaque groupe local, par thread
+  std::vector<std::vector<std::uint32_t>> locals(threads);
+  std::vector<std::vector<std::size_t>> firsts(threads);
+  run_threads(threads, [&](unsigned t) {
+    std::unordered_map<std::uint64_t, std::uint32_t> heads;
+    std::vector<std::uint32_t> chain;
+    auto &local{locals[t]};
+    auto &first{firsts[t]};
+    for (auto b{bucket_offsets[t]}; b < bucket_offsets[t + 1]; ++b) {
+      auto i{buckets[b]};
+      auto id{static_cast<std::uint32_t>(first.size())};
+      auto [position, inserted]{heads.try_emplace(hashes[i], id)};
+      if (!inserted) {
+        auto candidate{position->second};
+        while (candidate != NONE_ && !same(store, first[candidate], i)) {
+          candidate = chain[candidate];
+        }
+        if (candidate != NONE_) {
+          local.push_back(candidate);
+          continue;
+        }
+        // collision d'empreintes : nouvelle tête de chaîne
+        chain.push_back(position->second);
+        position->second = id;
+      } else {
+        chain.push_back(NONE_);
+      }
+      first.push_back(i);
+      local.push_back(id);
+    }
+  });
+
+  // numérotation globale dans l'ordre des premiers pronostics
+  std::vector<std::vector<std::uint32_t>> globals(threads);
+  std::size_t distinct{0};
+  for (unsigned t{0}; t < threads; ++t) {
+    globals[t].assign(firsts[t].size(), NONE_);
+    distinct += firsts[t].size();
+  }
+  if (bitmask()) {
+    masks_.reserve(distinct);
+  } else {
+    values_.reserve(distinct * parameter_.length());
+  }
+  std::vector<std::size_t> cursors(threads);
+  std::vector<std::size_t> counts;
+  counts.reserve(distinct);
+  for (std::size_t i{0}; i < size; ++i) {
+    auto t{owner(hashes[i])};
+    auto &global{globals[t][locals[t][cursors[t]++]]};
+    if (global == NONE_) {
+      global = static_cast<std::uint32_t>(counts.size());
+      counts.push_back(0);
+      if (bitmask()) {
+        masks_.push_back(store.masks()[i]);
+      } else {
+        auto first{std::cbegin(store.values()) + i * parameter_.length()};
+        values_.insert(std::end(values_), first,
+                       first + parameter_.length());
+      }
+    }
+    groups_[i] = global;
+    ++counts[global];
+  }
+
+  offsets_.resize(counts.size() + 1);
+  for (std::size_t d{0}; d < counts.size(); ++d) {
+    offsets_[d + 1] = offsets_[d] + counts[d];
+  }
+  pronostics_.resize(size);
+  owner_ids_.resize(size);
+  std::copy(std::begin(offsets_), std::end(offsets_) - 1,
+            std::begin(counts));
+  for (std::size_t i{0}; i < size; ++i) {
+    auto position{counts[groups_[i]]++};
+    pronostics_[position] = i;
+    owner_ids_[position] = store.owner_id(i);
+  }
+}
+
+std::uint64_t DistinctGrids::hash(const PronosticStore &store,
+                                  std::size_t index) {
+  if (store.bitmask()) {
+    return lotto::hash(store.masks()[index]);
+  }
+  // les valeurs sont enchaînées deux par deux, comme les deux mots
+  // d'un masque
+  const auto length{store.parameter().length()};
+  auto first{std::cbegin(store.values()) + index * length};
+  std::uint64_t result{length};
+  for (auto last{first + length}; first != last; ++first) {
+    result = lotto::hash({result, *first});
+  }
+  return result;
+}
+
+bool DistinctGrids::same(const PronosticStore &store,
+                         std::size_t lhs, std::size_t rhs) {
+  if (store.bitmask()) {
+    return store.masks()[lhs] == store.masks()[rhs];
+  }
+  const auto length{store.parameter().length()};
+  auto first{std::cbegin(store.values())};
+  return std::equal(first + lhs * length, first + (lhs + 1) * length,
+                    first + rhs * length);
+}
+
+const Parameter &DistinctGrids::parameter() const {
+  return parameter_;
+}
+
+std::size_t DistinctGrids::size() const {
+  return offsets_.size() - 1;
+}
+
+std::size_t DistinctGrids::pronostic_count() const {
+  return groups_.size();
+}
+
+bool DistinctGrids::bitmask() const {
+  return parameter_.maximum() < Grid::MASK_BITS_;
+}
+
+const std::vector<Grid::mask_type> &DistinctGrids::masks() const {
+  return masks_;
+}
+
+const std::vector<unsigned> &DistinctGrids::values() const {
+  return values_;
+}
+
+Grid DistinctGrids::grid(std::size_t index) const {
+  if (bitmask()) {
+    return Grid{masks_[index]};
+  }
+  auto first{std::cbegin(values_) + index * parameter_.length()};
+  return {first, first + parameter_.length(), parameter_.maximum()};
+}
+
+std::size_t DistinctGrids::multiplicity(std::size_t index) const {
+  return offsets_[index + 1] - offsets_[index];
+}
+
+const std::size_t *DistinctGrids::pronostics(std::size_t index) const {
+  return pronostics_.data() + offsets_[index];
+}
+
+const std::uint32_t *DistinctGrids::owner_ids(std::size_t index) const {
+  return owner_ids_.data() + offsets_[index];
+}
+
+std::size_t DistinctGrids::group(std::size_t pronostic) const {
+  return groups_[pronostic];
+}
+
+DedupStats DistinctGrids::stats() const {
+  DedupStats result{pronostic_count(), size(), 0};
+  for (std::size_t d{0}; d < size(); ++d) {
+    result.max_multiplicity = std::max(result.max_multiplicity,
+                                       multiplicity(d));
+  }
+  return result;
+}
+
+unsigned DistinctGrids::matches(std::size_t index,
+                                const Grid &grid) const {
+  if (bitmask() && grid.bitmask()) {
+    const auto &mask{masks_[index]};
+    return popcount(mask[0] & grid.mask()[0])
+           + popcount(mask[1] & grid.mask()[1]);
+  }
+  return this->grid(index).matches(grid);
+}
+
+std::vector<unsigned long long>
+DistinctGrids::match_histogram(const Grid &draw, unsigned threads) const {
+  return parallel_histogram(
+      size(), parameter_.length() + 1, threads,
+      [&](unsigned, std::size_t first, std::size_t last,
+          unsigned long long *count) {
+        if (bitmask() && draw.bitmask()) {
+          constexpr std::size_t BLOCK{4096};
+          std::array<unsigned char, BLOCK> block;
+          for (; first < last; first += BLOCK) {
+            auto n{std::min(BLOCK, last - first)};
+            if (!with_preset(parameter_, [&](auto preset) {
+                  preset.matches(masks_.data() + first, n, draw.mask(),
+                                 block.data());
+                })) {
+              lotto::matches(masks_.data() + first, n, draw.mask(),
+                             block.data());
+            }
+            for (std::size_t i{0}; i < n; ++i) {
+              count[block[i]] += multiplicity(first + i);
+            }
+          }
+        } else {
+          for (; first < last; ++first) {
+            count[matches(first, draw)] += multiplicity(first);
+          }
+        }
+      });
+}
+
+}
+
+#endif // DEDUP_H
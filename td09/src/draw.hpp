@@ -11,11 +11,7 @@
 #include "item.hpp"
 #include "parameter.hpp"
 
-#include <set>
 #include <vector>
-#include <numeric>
-#include <algorithm>
-#include <iterator>
 
 #include "../resources/random.hpp"
 
@@ -31,15 +27,18 @@ class Draw : public Item {
   /*!
    * \brief Méthode réalisant le tirage.
    *
-   * Le std::set d'`unsigned` retourné respecte en taille
+   * Le std::vector trié d'`unsigned` retourné respecte en taille
    * et valeurs les paramètres du jeu de lotto fournis via
    * l'argument `parameter`.
    *
    * \param parameter paramètres du jeu de lotto.
+   * \param engine générateur de nombres aléatoires à utiliser.
    *
    * \return tirage valide pour le lotto paramétré par `parameter`.
    */
-  inline std::set<unsigned> draw(const Parameter &parameter) const;
+  template<typename Engine>
+  inline std::vector<unsigned> draw(const Parameter &parameter,
+                                    Engine &engine) const;
 
  public:
 
@@ -55,6 +54,37 @@ class Draw : public Item {
    */
   inline explicit Draw(const Parameter &parameter);
 
+  /*!
+   * \brief Constructeur d'un tirage au sort avec un générateur
+   *        donné.
+   *
+   * Avec un générateur de graine connue, par exemple
+   * nvs::urng(const nvs::seed &), le tirage est reproductible et
+   * ne dépend pas du générateur partagé : plusieurs threads
+   * peuvent tirer en même temps, chacun avec le sien.
+   *
+   * \param parameter paramètres du jeu de lotto.
+   * \param engine générateur de nombres aléatoires à utiliser.
+   */
+  template<typename Engine>
+  inline Draw(const Parameter &parameter, Engine &engine);
+
+  /*!
+   * \brief Constructeur d'un tirage de valeurs connues.
+   *
+   * Sert à imposer un tirage ou à restaurer celui d'une
+   * sauvegarde. Les valeurs sont vérifiées comme par
+   * Item::Item().
+   *
+   * \param values conteneur quelconque de valeurs.
+   * \param parameter paramètres du jeu de lotto.
+   *
+   * \throw std::invalid_argument si les valeurs ne respectent
+   *          pas `parameter`.
+   */
+  template<typename Container>
+  inline Draw(const Container &values, const Parameter &parameter);
+
   /*!
    * \brief Constructeur virtuel par défaut.
    */
@@ -64,20 +94,29 @@ class Draw : public Item {
 // implémentation méthodes inline
 
 Draw::Draw(const Parameter &parameter) :
-    Item{draw(parameter), parameter}
+    Draw{parameter, nvs::urng()} {}
+
+template<typename Engine>
+Draw::Draw(const Parameter &parameter, Engine &engine) :
+    Item{draw(parameter, engine), parameter}
 // rem. : on doit fournir parameter à draw car au moment de
 //        l'appel de draw l'attribut parameter_ n'est
 //        (peut-être) pas encore construit
 {}
 
-std::set<unsigned> Draw::draw(const Parameter &parameter) const {
-  using namespace std;
-  vector<unsigned> universe(parameter.maximum() -
-      parameter.minimum() + 1);
-  iota(begin(universe), end(universe), parameter.minimum());
-  shuffle(begin(universe), end(universe), nvs::urng());
-  return {cbegin(universe), cbegin(universe) +
-      parameter.length()};
+template<typename Container>
+Draw::Draw(const Container &values, const Parameter &parameter) :
+    Item{values, parameter} {}
+
+template<typename Engine>
+std::vector<unsigned> Draw::draw(const Parameter &parameter,
+                                 Engine &engine) const {
+  // algorithme de Floyd : O(length) quelle que soit la taille de
+  // la grille, les valeurs arrivent déjà triées
+  return nvs::random_sample(parameter.length(),
+                            parameter.minimum(),
+                            parameter.maximum(),
+                            engine);
 }
 
 }
@@ -0,0 +1,594 @@
+/**
+ * @file grid.hpp
+ * @brief Définition de la classe g54327::lotto::Grid.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef GRID_H
+#define GRID_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Ensemble compact de valeurs d'une grille de lotto.
+ *
+ * Tant que la valeur maximale de la grille est inférieure à
+ * \ref MASK_BITS_, les valeurs sont stockées dans un masque de
+ * 128 bits : le bit `v` est à 1 si et seulement si la valeur `v`
+ * fait partie de la grille. Une grille tient alors en quelques mots,
+ * sans allocation. Au-delà, les valeurs sont rangées dans un
+ * std::vector trié.
+ *
+ * Dans les deux cas, chaque valeur est unique et le parcours se fait
+ * par ordre croissant, comme pour le std::set qu'elle remplace.
+ */
+class Grid {
+ public:
+  /*!
+   * \brief Nombre de valeurs représentables par le masque.
+   */
+  static constexpr unsigned MASK_BITS_{128};
+
+  /*!
+   * \brief Type du masque de bits.
+   *
+   * Le mot d'indice 0 contient les valeurs 0 à 63, celui d'indice 1
+   * les valeurs 64 à 127.
+   */
+  using mask_type = std::array<std::uint64_t, 2>;
+
+  class const_iterator;
+
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+ private:
+  /*!
+   * \brief Masque des valeurs, nul si \ref bitmask_ est faux.
+   */
+  mask_type mask_;
+
+  /*!
+   * \brief Valeurs triées, vide si \ref bitmask_ est vrai.
+   */
+  std::vector<unsigned> sorted_;
+
+  /*!
+   * \brief Représentation utilisée.
+   */
+  bool bitmask_;
+
+ public:
+
+  /*!
+   * \brief Constructeur d'une grille vide.
+   */
+  inline Grid();
+
+  /*!
+   * \brief Constructeur à partir d'un intervalle de valeurs.
+   *
+   * Chaque valeur est transtypée en `unsigned`. Les doublons sont
+   * éliminés, comme dans un std::set.
+   *
+   * Le masque est utilisé si `maximum` et toutes les valeurs sont
+   * inférieurs à \ref MASK_BITS_. Une valeur hors de la grille
+   * reste ainsi représentable, pour que l'appelant puisse la
+   * détecter et la refuser.
+   *
+   * \param first début de l'intervalle de valeurs.
+   * \param last fin de l'intervalle de valeurs.
+   * \param maximum valeur maximale de la grille.
+   */
+  template<typename InputIt>
+  inline Grid(InputIt first, InputIt last, unsigned maximum);
+
+  /*!
+   * \brief Constructeur à partir d'un masque.
+   *
+   * \param mask masque des valeurs de la grille.
+   *
+   * \see mask()
+   */
+  inline explicit Grid(const mask_type &mask);
+
+  /*!
+   * \brief Nombre de valeurs.
+   *
+   * \return le nombre de valeurs de la grille.
+   */
+  inline std::size_t size() const;
+
+  /*!
+   * \brief Grille vide ou non.
+   *
+   * \return `true` si la grille ne contient aucune valeur.
+   */
+  inline bool empty() const;
+
+  /*!
+   * \brief Test d'appartenance.
+   *
+   * \param value valeur recherchée.
+   *
+   * \return `true` si `value` fait partie de la grille.
+   */
+  inline bool contains(unsigned value) const;
+
+  /*!
+   * \brief Test d'appartenance à la façon d'un std::set.
+   *
+   * \param value valeur recherchée.
+   *
+   * \return 1 si `value` fait partie de la grille, 0 sinon.
+   */
+  inline std::size_t count(unsigned value) const;
+
+  /*!
+   * \brief Représentation utilisée.
+   *
+   * \return `true` si les valeurs sont stockées dans le masque.
+   */
+  inline bool bitmask() const;
+
+  /*!
+   * \brief Accesseur en lecture du masque.
+   *
+   * \return le masque des valeurs, nul si bitmask() est faux.
+   */
+  inline const mask_type &mask() const;
+
+  /*!
+   * \brief Nombre de valeurs communes à deux grilles.
+   *
+   * Si les deux grilles utilisent le masque, c'est un ET bit à bit
+   * suivi d'un comptage des bits à 1. Sinon, les deux suites triées
+   * sont parcourues en parallèle.
+   *
+   * \param other autre grille.
+   *
+   * \return le nombre de valeurs présentes dans les deux grilles.
+   */
+  inline unsigned matches(const Grid &other) const;
+
+  /*!
+   * \brief Itérateur sur la plus petite valeur.
+   *
+   * \return itérateur de début.
+   */
+  inline const_iterator begin() const;
+
+  /*!
+   * \brief Itérateur après la plus grande valeur.
+   *
+   * \return itérateur de fin.
+   */
+  inline const_iterator end() const;
+
+  /*!
+   * \brief Itérateur inverse sur la plus grande valeur.
+   *
+   * \return itérateur inverse de début.
+   */
+  inline const_reverse_iterator rbegin() const;
+
+  /*!
+   * \brief Itérateur inverse avant la plus petite valeur.
+   *
+   * \return itérateur inverse de fin.
+   */
+  inline const_reverse_iterator rend() const;
+
+  /*!
+   * \brief Comparaison de deux grilles.
+   *
+   * \return `true` si les deux grilles ont les mêmes valeurs.
+   */
+  inline friend bool operator==(const Grid &lhs, const Grid &rhs);
+
+  inline friend bool operator!=(const Grid &lhs, const Grid &rhs);
+};
+
+/*!
+ * \brief Itérateur constant sur les valeurs d'une Grid, par ordre
+ *        croissant.
+ *
+ * Les valeurs du masque n'existent pas en mémoire : le
+ * déréférencement retourne donc une copie.
+ */
+class Grid::const_iterator {
+  const Grid *grid_;
+  std::size_t index_;
+  unsigned value_;
+
+  friend class Grid;
+
+  inline const_iterator(const Grid *grid, std::size_t index,
+                        unsigned value);
+
+  inline void next_bit(unsigned from);
+
+  inline void previous_bit(unsigned before);
+
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = unsigned;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = unsigned;
+
+  const_iterator() = default;
+
+  inline reference operator*() const;
+
+  inline const_iterator &operator++();
+
+  inline const_iterator operator++(int);
+
+  inline const_iterator &operator--();
+
+  inline const_iterator operator--(int);
+
+  inline friend bool operator==(const const_iterator &lhs,
+                                const const_iterator &rhs);
+
+  inline friend bool operator!=(const const_iterator &lhs,
+                                const const_iterator &rhs);
+};
+
+// prototypes
+
+/*!
+ * \brief Nombre de bits à 1 d'un mot.
+ *
+ * \param word mot de 64 bits.
+ *
+ * \return le nombre de bits à 1 de `word`.
+ */
+inline unsigned popcount(std::uint64_t word);
+
+/*!
+ * \brief Empreinte d'un masque, pour les tables de hachage.
+ *
+ * Les deux mots sont mélangés par le finaliseur de splitmix64 :
+ * tous les bits de l'empreinte dépendent de tous les bits du
+ * masque.
+ *
+ * \param mask masque d'une grille.
+ *
+ * \return empreinte de 64 bits de `mask`.
+ */
+inline std::uint64_t hash(const Grid::mask_type &mask);
+
+/*!
+ * \brief Nombre de valeurs communes entre un masque et chaque
+ *        masque d'un tableau contigu.
+ *
+ * C'est la version en lot de Grid::matches() : pour chaque
+ * masque, un ET bit à bit avec `draw` suivi d'un comptage des
+ * bits à 1. La boucle, sans branchement, est vectorisée par le
+ * compilateur quand le jeu d'instructions de la cible le permet
+ * (AVX2, AVX-512 VPOPCNTDQ, option `TD09_NATIVE`).
+ *
+ * \param masks tableau de `count` masques.
+ * \param count nombre de masques.
+ * \param draw masque comparé à chacun des masques.
+ * \param result tableau de `count` résultats.
+ */
+inline void matches(const Grid::mask_type *masks, std::size_t count,
+                    const Grid::mask_type &draw, unsigned char *result);
+
+/*!
+ * \brief Comptage par niveau des éléments d'un lot.
+ *
+ * Quatre séries de compteurs sont entrelacées : deux
+ * incrémentations successives touchent rarement le même
+ * compteur.
+ *
+ * \param count nombre d'éléments.
+ * \param level niveau de l'élément d'indice donné, inférieur à
+ *              `levels`.
+ * \param levels nombre de niveaux.
+ * \param lanes `4 * levels` compteurs de travail, remis à zéro.
+ * \param counts compteurs, un par niveau, incrémentés.
+ */
+template<typename Level, typename Lane>
+inline void histogram(std::size_t count, Level level, std::size_t levels,
+                      Lane *lanes, unsigned long long *counts);
+
+/*!
+ * \brief Itérateur de début, pour la recherche par ADL de
+ *        `cbegin` dans Item::Item().
+ */
+inline Grid::const_iterator cbegin(const Grid &grid);
+
+/*!
+ * \brief Itérateur de fin, pour la recherche par ADL de
+ *        `cend` dans Item::Item().
+ */
+inline Grid::const_iterator cend(const Grid &grid);
+
+// implémentation méthodes inline
+
+Grid::Grid() :
+    mask_{},
+    sorted_{},
+    bitmask_{true} {}
+
+Grid::Grid(const mask_type &mask) :
+    mask_{mask},
+    sorted_{},
+    bitmask_{true} {}
+
+template<typename InputIt>
+Grid::Grid(InputIt first, InputIt last, unsigned maximum) :
+    mask_{},
+    sorted_{},
+    bitmask_{maximum < MASK_BITS_} {
+  for (; first != last; ++first) {
+    auto value{static_cast<unsigned>(*first)};
+    if (bitmask_ && value < MASK_BITS_) {
+      mask_[value / 64] |= std::uint64_t{1} << value % 64;
+    } else {
+      if (bitmask_) {
+        // valeur hors du masque : on passe au std::vector
+        sorted_.assign(begin(), end());
+        mask_ = {};
+        bitmask_ = false;
+      }
+      sorted_.push_back(value);
+    }
+  }
+
+  if (!bitmask_) {
+    std::sort(std::begin(sorted_), std::end(sorted_));
+    sorted_.erase(std::unique(std::begin(sorted_), std::end(sorted_)),
+                  std::end(sorted_));
+  }
+}
+
+std::size_t Grid::size() const {
+  return bitmask_ ? popcount(mask_[0]) + popcount(mask_[1])
+                  : sorted_.size();
+}
+
+bool Grid::empty() const {
+  return size() == 0;
+}
+
+bool Grid::contains(unsigned value) const {
+  if (bitmask_) {
+    return value < MASK_BITS_ && (mask_[value / 64] >> value % 64 & 1);
+  }
+  return std::binary_search(std::begin(sorted_), std::end(sorted_),
+                            value);
+}
+
+std::size_t Grid::count(unsigned value) const {
+  return contains(value) ? 1 : 0;
+}
+
+bool Grid::bitmask() const {
+  return bitmask_;
+}
+
+const Grid::mask_type &Grid::mask() const {
+  return mask_;
+}
+
+unsigned Grid::matches(const Grid &other) const {
+  if (bitmask_ && other.bitmask_) {
+    return popcount(mask_[0] & other.mask_[0])
+           + popcount(mask_[1] & other.mask_[1]);
+  }
+
+  unsigned result{0};
+  auto lhs{begin()};
+  auto rhs{other.begin()};
+  while (lhs != end() && rhs != other.end()) {
+    if (*lhs < *rhs) {
+      ++lhs;
+    } else if (*rhs < *lhs) {
+      ++rhs;
+    } else {
+      ++result;
+      ++lhs;
+      ++rhs;
+    }
+  }
+  return result;
+}
+
+Grid::const_iterator Grid::begin() const {
+  if (!bitmask_) {
+    return {this, 0, 0};
+  }
+  const_iterator result{this, 0, 0};
+  result.next_bit(0);
+  return result;
+}
+
+Grid::const_iterator Grid::end() const {
+  return bitmask_ ? const_iterator{this, 0, MASK_BITS_}
+                  : const_iterator{this, sorted_.size(), 0};
+}
+
+Grid::const_reverse_iterator Grid::rbegin() const {
+  return const_reverse_iterator{end()};
+}
+
+Grid::const_reverse_iterator Grid::rend() const {
+  return const_reverse_iterator{begin()};
+}
+
+bool operator==(const Grid &lhs, const Grid &rhs) {
+  if (lhs.bitmask_ && rhs.bitmask_) {
+    return lhs.mask_ == rhs.mask_;
+  }
+  return lhs.size() == rhs.size()
+         && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+bool operator!=(const Grid &lhs, const Grid &rhs) {
+  return !(lhs == rhs);
+}
+
+Grid::const_iterator::const_iterator(const Grid *grid,
+                                     std::size_t index,
+                                     unsigned value) :
+    grid_{grid},
+    index_{index},
+    value_{value} {}
+
+void Grid::const_iterator::next_bit(unsigned from) {
+  for (unsigned word{from / 64}; word < 2; ++word) {
+    std::uint64_t bits{grid_->mask_[word]};
+    if (word == from / 64) {
+      bits &= ~std::uint64_t{0} << from % 64;
+    }
+    if (bits != 0) {
+      value_ = 64 * word + popcount((bits & (0 - bits)) - 1);
+      return;
+    }
+  }
+  value_ = MASK_BITS_;
+}
+
+void Grid::const_iterator::previous_bit(unsigned before) {
+  for (unsigned word{std::min(before / 64, 1u) + 1}; word-- > 0;) {
+    std::uint64_t bits{grid_->mask_[word]};
+    if (word == before / 64) {
+      bits &= (std::uint64_t{1} << before % 64) - 1;
+    }
+    if (bits != 0) {
+      // tous les bits sous le plus haut bit à 1 passent à 1
+      bits |= bits >> 1;
+      bits |= bits >> 2;
+      bits |= bits >> 4;
+      bits |= bits >> 8;
+      bits |= bits >> 16;
+      bits |= bits >> 32;
+      value_ = 64 * word + popcount(bits) - 1;
+      return;
+    }
+  }
+}
+
+Grid::const_iterator::reference Grid::const_iterator::operator*() const {
+  return grid_->bitmask_ ? value_ : grid_->sorted_[index_];
+}
+
+Grid::const_iterator &Grid::const_iterator::operator++() {
+  if (grid_->bitmask_) {
+    next_bit(value_ + 1);
+  } else {
+    ++index_;
+  }
+  return *this;
+}
+
+Grid::const_iterator Grid::const_iterator::operator++(int) {
+  const_iterator result{*this};
+  ++*this;
+  return result;
+}
+
+Grid::const_iterator &Grid::const_iterator::operator--() {
+  if (grid_->bitmask_) {
+    previous_bit(value_);
+  } else {
+    --index_;
+  }
+  return *this;
+}
+
+Grid::const_iterator Grid::const_iterator::operator--(int) {
+  const_iterator result{*this};
+  --*this;
+  return result;
+}
+
+bool operator==(const Grid::const_iterator &lhs,
+                const Grid::const_iterator &rhs) {
+  return lhs.grid_ == rhs.grid_ && lhs.index_ == rhs.index_
+         && lhs.value_ == rhs.value_;
+}
+
+bool operator!=(const Grid::const_iterator &lhs,
+                const Grid::const_iterator &rhs) {
+  return !(lhs == rhs);
+}
+
+// implémentation fonctions inline
+
+unsigned popcount(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+  word = word - (word >> 1 & 0x5555555555555555u);
+  word = (word & 0x3333333333333333u) + (word >> 2 & 0x3333333333333333u);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Fu;
+  return static_cast<unsigned>(word * 0x0101010101010101u >> 56);
+#endif
+}
+
+std::uint64_t hash(const Grid::mask_type &mask) {
+  auto mix{[](std::uint64_t x) {
+    x = (x ^ x >> 30) * 0xBF58476D1CE4E5B9u;
+    x = (x ^ x >> 27) * 0x94D049BB133111EBu;
+    return x ^ x >> 31;
+  }};
+  return mix(mask[0] ^ mix(mask[1] + 0x9E3779B97F4A7C15u));
+}
+
+void matches(const Grid::mask_type *masks, std::size_t count,
+             const Grid::mask_type &draw, unsigned char *result) {
+  const std::uint64_t low{draw[0]};
+  const std::uint64_t high{draw[1]};
+  for (std::size_t i{0}; i < count; ++i) {
+    result[i] = static_cast<unsigned char>(popcount(masks[i][0] & low)
+                                           + popcount(masks[i][1] & high));
+  }
+}
+
+template<typename Level, typename Lane>
+void histogram(std::size_t count, Level level, std::size_t levels,
+               Lane *lanes, unsigned long long *counts) {
+  std::fill(lanes, lanes + 4 * levels, Lane{0});
+  std::size_t i{0};
+  for (; i + 4 <= count; i += 4) {
+    ++lanes[level(i)];
+    ++lanes[levels + level(i + 1)];
+    ++lanes[2 * levels + level(i + 2)];
+    ++lanes[3 * levels + level(i + 3)];
+  }
+  for (; i < count; ++i) {
+    ++lanes[level(i)];
+  }
+  for (std::size_t k{0}; k < levels; ++k) {
+    counts[k] += lanes[k] + lanes[levels + k] + lanes[2 * levels + k]
+                 + lanes[3 * levels + k];
+  }
+}
+
+Grid::const_iterator cbegin(const Grid &grid) {
+  return grid.begin();
+}
+
+Grid::const_iterator cend(const Grid &grid) {
+  return grid.end();
+}
+
+}
+
+#endif // GRID_H
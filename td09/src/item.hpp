@@ -9,11 +9,11 @@
 #ifndef ITEM_H
 #define ITEM_H
 
-#include <set>
 #include <string>
 #include <ostream>
 #include <stdexcept>
 
+#include "grid.hpp"
 #include "parameter.hpp"
 
 /*!
@@ -45,9 +45,11 @@ class Item {
    *        pronostic) ou tirées aléatoirement (dans le cas d'un
    *        tirage).
    *
-   * Comme il s'agit d'un std::set, chaque valeur y est unique.
+   * Comme il s'agit d'une Grid, chaque valeur y est unique et
+   * le parcours se fait par ordre croissant. Tant que la grille
+   * tient dans son masque de bits, aucune allocation n'est faite.
    */
-  const std::set<unsigned> values_;
+  const Grid values_;
 
   /*!
    * \brief Vérification de tailles.
@@ -101,8 +103,8 @@ class Item {
    * nommées `cbegin()` et `cend()`. La première retourne un
    * itérateur de valeurs constantes sur son premier élément.
    * La seconde un itérateur passé son dernier élément. Par
-   * ailleurs, comme \ref values_ est un
-   * std::set<unsigned>,  `values` peut ne pas survire à l'appel
+   * ailleurs, comme \ref values_ est une
+   * Grid,  `values` peut ne pas survire à l'appel
    * du constructeur et son contenu doit pouvoir être
    * transtypé en `unsigned`. Voici un appel valide :
    *
@@ -204,7 +206,7 @@ class Item {
    *
    * \return les valeurs de cet élément de lotto.
    */
-  inline const std::set<unsigned> &values() const;
+  inline const Grid &values() const;
 
   /*!
    * \brief Conversion d'un Item en std::string.
@@ -218,6 +220,18 @@ class Item {
    * \see to_string(const Item &)
    */
   inline virtual std::string to_string() const;
+
+  /*!
+   * \brief Écriture d'un Item à la fin d'un tampon.
+   *
+   * Même mise en forme que to_string(), écrite directement
+   * dans `out` : aucune std::string intermédiaire n'est créée.
+   * Les classes filles complètent cette méthode plutôt que
+   * to_string().
+   *
+   * \param out tampon à compléter.
+   */
+  inline virtual void write(std::string &out) const;
 };
 
 // prototypes
@@ -280,7 +294,7 @@ void Item::checkValues() const {
 template<typename Container>
 Item::Item(const Container &values, const Parameter &parameter) :
     parameter_{parameter},
-    values_{cbegin(values), cend(values)}
+    values_{cbegin(values), cend(values), parameter.maximum()}
 // ici cbegin et cend recherchés dans namespace de container
 // car ADL : https://en.cppreference.com/w/cpp/language/adl
 {
@@ -296,17 +310,23 @@ const Parameter &Item::parameter() const {
   return parameter_;
 }
 
-const std::set<unsigned> &Item::values() const {
+const Grid &Item::values() const {
   return values_;
 }
 
 std::string Item::to_string() const {
-  std::string result{parameter_.to_string()};
-  result.append(" :: { ");
+  std::string result;
+  write(result);
+  return result;
+}
+
+void Item::write(std::string &out) const {
+  parameter_.write(out);
+  out.append(" :: { ");
   for (auto e : values_) {
-    result.append(std::to_string(e)).append(" ");
+    append_number(out, e).push_back(' ');
   }
-  return result.append("}");
+  out.push_back('}');
 }
 
 // implémentation fonctions inline
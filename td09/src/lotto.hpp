@@ -12,11 +12,26 @@
 #include "parameter.hpp"
 #include "pronostic.hpp"
 #include "draw.hpp"
+#include "store.hpp"
+#include "preset.hpp"
+#include "validation.hpp"
+#include "snapshot.hpp"
+#include "simulation.hpp"
+#include "dedup.hpp"
+#include "coverage.hpp"
+#include "parallel.hpp"
 
+#include <array>
 #include <vector>
+#include <algorithm>
 #include <optional>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+#include <tuple>
 #include <string>
 #include <ostream>
+#include <limits>
 
 
 /*!
@@ -24,6 +39,25 @@
  */
 namespace g54327::lotto {
 
+/*!
+ * \brief Bilan des pronostics d'un propriétaire.
+ *
+ * \see Lotto::summary(), Lotto::summaries()
+ */
+struct OwnerSummary {
+  /*!
+   * \brief Nombre de pronostics du propriétaire.
+   */
+  std::size_t grids;
+
+  /*!
+   * \brief Plus grand nombre de valeurs du tirage présentes dans
+   *        l'un de ses pronostics, s'il a des pronostics et si
+   *        le tirage a eu lieu.
+   */
+  std::optional<unsigned> best_match;
+};
+
 /*!
  * \brief Classe gérant un jeu de lotto.
  *
@@ -46,15 +80,71 @@ class Lotto {
   const Parameter parameter_;
 
   /*!
-   * \brief Ensemble des pronostics de ce jeu de lotto.
+   * \brief Ensemble des pronostics de ce jeu de lotto, rangés
+   *        par colonnes.
+   *
+   * Les masques des grilles y sont contigus, ce qui permet à
+   * winner() et match_histogram() de comparer les pronostics
+   * au tirage sans reconstruire de Pronostic.
    */
-  std::vector<Pronostic> pronostics_;
+  PronosticStore pronostics_;
 
   /*!
    * \brief Tirage de ce jeu de lotto.
    */
   std::optional<Draw> draw_;
 
+  /*!
+   * \brief Comptage des valeurs communes au tirage d'une plage
+   *        de pronostics.
+   *
+   * Pour chaque pronostic d'indice dans [`first`, `last`[,
+   * `counts[k]` est incrémenté, où `k` est le nombre de valeurs
+   * du pronostic présentes dans le tirage. Si `winners` n'est pas
+   * nul et que `k` vaut au moins `minimum_level`, l'indice du
+   * pronostic est ajouté à `(*winners)[k]`.
+   *
+   * Le tirage doit avoir eu lieu.
+   *
+   * \param first indice du premier pronostic.
+   * \param last indice suivant le dernier pronostic.
+   * \param counts compteurs, un par niveau de 0 à la taille du
+   *               tirage.
+   * \param winners indices par niveau, ou `nullptr`.
+   * \param minimum_level niveau à partir duquel les indices sont
+   *                      retenus.
+   */
+  inline void match_range(std::size_t first, std::size_t last,
+                          unsigned long long *counts,
+                          std::vector<std::vector<std::size_t>> *winners,
+                          unsigned minimum_level) const;
+
+  /*!
+   * \brief Répartition de match_range() sur plusieurs threads.
+   *
+   * Les pronostics sont découpés en autant de plages contiguës
+   * que de threads. Chaque thread a ses propres compteurs et
+   * listes d'indices, fusionnés dans l'ordre des plages : les
+   * indices restent donc croissants.
+   *
+   * \see match_histogram()
+   */
+  inline std::vector<unsigned long long>
+  parallel_match(std::vector<std::vector<std::size_t>> *winners,
+                 unsigned minimum_level, unsigned threads) const;
+
+  /*!
+   * \brief Mise en forme commune à to_string() et write().
+   *
+   * \param buffer tampon à compléter.
+   * \param flush appelé avec `buffer` dès qu'il dépasse
+   *              `limit` caractères, pour le vider.
+   * \param limit taille au-delà de laquelle `flush` est appelé.
+   */
+  template<typename Flush>
+  inline void format(std::string &buffer, Flush flush,
+                     std::size_t limit) const;
+
  public:
 
   /*!
@@ -84,6 +174,40 @@ class Lotto {
                         unsigned maximum = Parameter::MAXIMUM_DEFAULT_,
                         unsigned minimum = Parameter::MINIMUM_DEFAULT_);
 
+  /*!
+   * \brief Constructeur à partir d'une sauvegarde.
+   *
+   * Le paramétrage, les pronostics et, s'il a eu lieu, le
+   * tirage sont recopiés depuis la sauvegarde projetée en
+   * mémoire, en un passage linéaire sur chaque section. Chaque
+   * grille est contrôlée au passage (voir
+   * PronosticStore::restore()).
+   *
+   * \param snapshot sauvegarde ouverte.
+   *
+   * \throw std::invalid_argument si le paramétrage, le tirage ou
+   *          un identifiant de propriétaire sauvegardés sont
+   *          invalides.
+   * \throw std::runtime_error si une grille sauvegardée ne
+   *          respecte pas le paramétrage.
+   *
+   * \see save()
+   */
+  inline explicit Lotto(const Snapshot &snapshot);
+
+  /*!
+   * \brief Sauvegarde binaire du jeu de lotto.
+   *
+   * Le fichier produit se relit par Lotto(const Snapshot &).
+   *
+   * \param path chemin du fichier, écrasé s'il existe.
+   *
+   * \throw std::runtime_error si le fichier ne peut être écrit.
+   *
+   * \see Snapshot
+   */
+  inline void save(const std::string &path) const;
+
   /*!
    * \brief Accesseur en lecture des paramètres de la grille de
    *        lotto.
@@ -98,14 +222,16 @@ class Lotto {
    *
    * \return ensemble des pronostics.
    */
-  inline const std::vector<Pronostic> &pronostics() const;
+  inline const PronosticStore &pronostics() const;
 
   /*!
    * \brief Accesseur en écriture d'un pronostic.
    *
    * Le pronostic est associé aux paramètres du jeu de lotto. Il
-   * est construit à l'aide du constructeur
-   * Pronostic::Pronostic(const std::string &, const Container &, const Parameter &).
+   * est vérifié comme par le constructeur
+   * Pronostic::Pronostic(const std::string &, const Container &, const Parameter &)
+   * puis rangé dans \ref pronostics_, sans construire de
+   * Pronostic.
    *
    * Il est interdit d'ajouter un pronostic _après_ le tirage.
    *
@@ -140,8 +266,9 @@ class Lotto {
    *
    * Le pronostic est associé aux paramètres de la grille du jeu
    * de lotto. Il
-   * est construit à l'aide du constructeur
-   * Pronostic::Pronostic(const std::string &, const T (&) [N], const Parameter &).
+   * est vérifié comme par le constructeur
+   * Pronostic::Pronostic(const std::string &, const T (&) [N], const Parameter &)
+   * puis rangé dans \ref pronostics_.
    *
    * Il est interdit d'ajouter un pronostic _après_ le tirage.
    *
@@ -186,6 +313,59 @@ class Lotto {
    */
   inline Lotto &add(const Pronostic &pronostic);
 
+  /*!
+   * \brief Ajout d'un lot de pronostics.
+   *
+   * Chaque élément de `range` est une paire (ou un tuple) dont
+   * le premier élément est le propriétaire et le second les
+   * valeurs du pronostic, comme le retour de
+   * nvs::lotto::data(unsigned, unsigned, unsigned, unsigned).
+   *
+   * La place est réservée une seule fois pour tout le lot, puis
+   * chaque pronostic est vérifié et rangé comme par
+   * add(std::string, const Container &), sans construire de
+   * Pronostic. Si `range` est une rvalue, les propriétaires
+   * sont déplacés plutôt que copiés.
+   *
+   * Si un pronostic est refusé, ceux qui le précèdent dans
+   * `range` restent enregistrés.
+   *
+   * \param range lot de pronostics.
+   *
+   * \return le jeu de lotto.
+   *
+   * \throw std::logic_error si le tirage a déjà été réalisé.
+   *
+   * \throw std::invalid_argument si l'un des pronostics ne
+   *          respecte pas les paramètres de la grille du lotto.
+   */
+  template<typename Range>
+  inline Lotto &add_bulk(Range &&range);
+
+  /*!
+   * \brief Ajout des pronostics valides d'un lot, sans exception
+   *        par pronostic.
+   *
+   * Le lot, à accès direct et de même forme que pour
+   * add_bulk(), est d'abord vérifié en parallèle par
+   * validate(). Seuls les pronostics acceptés sont ensuite
+   * ajoutés, dans leur ordre. Un pronostic refusé ne coûte
+   * donc que sa vérification, pas le déroulement d'une
+   * exception.
+   *
+   * \param range lot de pronostics.
+   * \param threads nombre de threads pour la vérification, 0
+   *                pour le nombre de cœurs.
+   *
+   * \return la carte des pronostics refusés et leurs erreurs,
+   *         indicées dans `range`.
+   *
+   * \throw std::logic_error si le tirage a déjà été réalisé.
+   */
+  template<typename Range>
+  inline ValidationReport try_add_bulk(Range &&range,
+                                       unsigned threads = 0);
+
   /*!
    * \brief Opérateur pour l'accès en écriture d'un pronostic.
    *
@@ -256,8 +436,8 @@ class Lotto {
    * Cette méthode ne peut être invoquée qu'après le
    * tirage réalisé.
    *
-   * Elle retourne l'ensemble des pronostics
-   * comportant :
+   * Elle retourne l'ensemble des pronostics, dans leur ordre
+   * d'ajout, comportant :
    *
    *  + _exactement_ `predicted_length` chiffres présents
    *    dans le tirage lorsque la valeur de `type` est
@@ -266,6 +446,11 @@ class Lotto {
    *    le tirage lorsque la valeur de `type` est
    *    Equality::INCLUSIVE.
    *
+   * Si les grilles tiennent dans un masque, les valeurs
+   * communes sont comptées par lots sur
+   * PronosticStore::masks(), à l'aide
+   * de matches(const Grid::mask_type *, std::size_t, const Grid::mask_type &, unsigned char *).
+   *
    * \param predicted_length le nombre de chiffres du tirage
    *                         présents dans le pronostic.
    * \param type le type d'égalité utilisée (voir ci-dessus).
@@ -282,6 +467,164 @@ class Lotto {
   winner(unsigned predicted_length,
          Equality type = Equality::STRICT) const;
 
+  /*!
+   * \brief Histogramme des valeurs communes au tirage.
+   *
+   * Cette méthode ne peut être invoquée qu'après le
+   * tirage réalisé.
+   *
+   * Tous les pronostics sont comparés au tirage en une seule
+   * passe, répartie sur `threads` threads. L'élément d'indice
+   * `k` du résultat est le nombre de pronostics comportant
+   * _exactement_ `k` chiffres présents dans le tirage, pour `k`
+   * de 0 à la taille du tirage.
+   *
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return nombre de pronostics par nombre de valeurs communes.
+   *
+   * \throw std::logic_error si le tirage n'a pas encore eu lieu.
+   */
+  inline std::vector<unsigned long long>
+  match_histogram(unsigned threads = 0) const;
+
+  /*!
+   * \brief Histogramme des valeurs communes au tirage et indices
+   *        des gagnants.
+   *
+   * Comme match_histogram(unsigned) mais, en plus, `winners[k]`
+   * reçoit les indices croissants dans pronostics() des
+   * pronostics comportant exactement `k` chiffres du tirage,
+   * pour chaque `k` au moins égal à `minimum_level`. Les
+   * niveaux inférieurs, où se trouve l'essentiel des
+   * pronostics, restent vides.
+   *
+   * Les rangs de gains se calculent ainsi en une seule passe.
+   *
+   * \param winners indices des pronostics par niveau,
+   *                remplacés par le résultat.
+   * \param minimum_level plus petit niveau dont les indices sont
+   *                      retenus.
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return nombre de pronostics par nombre de valeurs communes.
+   *
+   * \throw std::logic_error si le tirage n'a pas encore eu lieu.
+   */
+  inline std::vector<unsigned long long>
+  match_histogram(std::vector<std::vector<std::size_t>> &winners,
+                  unsigned minimum_level = 1,
+                  unsigned threads = 0) const;
+
+  /*!
+   * \brief Dédoublonnage des grilles des pronostics de ce jeu.
+   *
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return les grilles distinctes, leurs pronostics et leurs
+   *         propriétaires.
+   */
+  inline DistinctGrids distinct(unsigned threads = 0) const;
+
+  /*!
+   * \brief Répartition des pronostics selon leur nombre de valeurs
+   *        communes avec le tirage, une comparaison par grille
+   *        distincte.
+   *
+   * Même résultat que match_histogram(unsigned), pour un jeu aux
+   * nombreuses grilles en double. `distinct` peut servir à
+   * plusieurs appels, tant que le jeu n'a pas de nouveau
+   * pronostic.
+   *
+   * \param distinct grilles distinctes de ce jeu, voir distinct().
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return nombre de pronostics par nombre de valeurs communes.
+   *
+   * \throw std::logic_error si le tirage n'a pas encore eu lieu.
+   * \throw std::invalid_argument si `distinct` n'a pas autant de
+   *          pronostics que ce jeu.
+   */
+  inline std::vector<unsigned long long>
+  match_histogram(const DistinctGrids &distinct,
+                  unsigned threads = 0) const;
+
+  /*!
+   * \brief Tables de couverture des pronostics de ce jeu.
+   *
+   * Elles donnent, avant le tirage, la répartition des gagnants
+   * de n'importe quel tirage candidat.
+   *
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return les tables de couverture de tous les pronostics.
+   *
+   * \throw std::invalid_argument si les grilles ne tiennent pas
+   *          dans un masque ou sont trop longues.
+   *
+   * \see CoverageTable
+   */
+  inline CoverageTable coverage(unsigned threads = 0) const;
+
+  /*!
+   * \brief Simulation de plusieurs tirages contre les pronostics
+   *        de ce jeu.
+   *
+   * Le tirage de ce jeu n'est ni utilisé ni modifié : la
+   * simulation peut avoir lieu avant comme après set_draw().
+   *
+   * \param draws nombre de tirages.
+   * \param seed graine des tirages.
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return les tirages et leurs histogrammes.
+   *
+   * \see g54327::lotto::simulate()
+   */
+  inline SimulationResult simulate(std::size_t draws,
+                                   const nvs::seed &seed,
+                                   unsigned threads = 0) const;
+
+  /*!
+   * \brief Pronostics d'un propriétaire.
+   *
+   * L'index des propriétaires est tenu à jour à chaque ajout :
+   * aucun pronostic n'est parcouru.
+   *
+   * \param owner propriétaire.
+   *
+   * \return indices croissants dans pronostics() des pronostics
+   *         de `owner`, vide s'il n'en a aucun.
+   */
+  inline const std::vector<std::size_t> &
+  pronostics_of(const std::string &owner) const;
+
+  /*!
+   * \brief Bilan des pronostics d'un propriétaire.
+   *
+   * Seuls les pronostics de `owner` sont comparés au tirage.
+   *
+   * \param owner propriétaire.
+   *
+   * \return nombre de pronostics de `owner` et, si le tirage a
+   *         eu lieu, sa meilleure correspondance.
+   */
+  inline OwnerSummary summary(const std::string &owner) const;
+
+  /*!
+   * \brief Bilan de tous les propriétaires.
+   *
+   * Les pronostics sont comparés au tirage en une passe
+   * parallèle, puis les correspondances sont regroupées par
+   * propriétaire.
+   *
+   * \param threads nombre de threads, 0 pour le nombre de cœurs.
+   *
+   * \return un bilan par propriétaire, dans l'ordre de
+   *         PronosticStore::owners().
+   */
+  inline std::vector<OwnerSummary> summaries(unsigned threads = 0) const;
+
   /*!
    * \brief Conversion d'un Lotto en std::string.
    *
@@ -299,6 +642,19 @@ class Lotto {
    * \see to_string(const Lotto &)
    */
   inline std::string to_string() const;
+
+  /*!
+   * \brief Écriture d'un Lotto dans un flux en sortie, au fil
+   *        de l'eau.
+   *
+   * Même mise en forme que to_string(), mais les pronostics sont
+   * écrits directement depuis leurs colonnes dans un tampon de
+   * taille fixe, vidé dans `out` dès qu'il est plein. Ni la
+   * représentation complète ni un Pronostic ne sont construits.
+   *
+   * \param out flux dans lequel écrire.
+   */
+  inline void write(std::ostream &out) const;
 };
 
 // prototypes
@@ -338,7 +694,7 @@ inline std::string to_string(const Lotto &lotto);
  *
  * \return flux après injection.
  *
- * \see Lotto::to_string()
+ * \see Lotto::write()
  */
 inline std::ostream &operator<<(std::ostream &out,
                                 const Lotto &lotto);
@@ -347,33 +703,119 @@ inline std::ostream &operator<<(std::ostream &out,
 
 Lotto::Lotto(unsigned length, unsigned maximum, unsigned minimum) :
     parameter_{Parameter{length, maximum, minimum}},
-    pronostics_{},
+    pronostics_{parameter_},
     draw_{} {}
 
 const Parameter &Lotto::parameter() const {
   return parameter_;
 }
 
-const std::vector<Pronostic> &Lotto::pronostics() const {
+Lotto::Lotto(const Snapshot &snapshot) :
+    parameter_{snapshot.parameter()},
+    pronostics_{parameter_},
+    draw_{} {
+  std::vector<std::string> owners;
+  owners.reserve(snapshot.owner_count());
+  for (std::size_t id{0}; id < snapshot.owner_count(); ++id) {
+    owners.emplace_back(snapshot.owner(id));
+  }
+  pronostics_.restore(snapshot.bitmask()
+                      ? static_cast<const void *>(snapshot.masks())
+                      : static_cast<const void *>(snapshot.values()),
+                      snapshot.owner_ids(), snapshot.size(),
+                      std::move(owners));
+
+  if (snapshot.has_draw()) {
+    std::vector<unsigned> values(snapshot.draw(),
+                                 snapshot.draw() + parameter_.length());
+    draw_.emplace(values, parameter_);
+  }
+}
+
+void Lotto::save(const std::string &path) const {
+  Snapshot::write(path, pronostics_,
+                  has_draw() ? &draw_->values() : nullptr);
+}
+
+const PronosticStore &Lotto::pronostics() const {
   return pronostics_;
 }
 
 template<typename Container>
 inline Lotto &Lotto::add(std::string owner,
                          const Container &values) {
-  return add(Pronostic{owner, values, parameter_});
+  if (has_draw()) {
+    throw std::logic_error("Le tiage a déja été réalisé");
+  }
+  pronostics_.add(std::move(owner), values);
+  return *this;
 }
 
 template<typename T, std::size_t N>
 Lotto &Lotto::add(std::string owner, const T (&values)[N]) {
-  return add(Pronostic{owner, values, parameter_});
+  if (has_draw()) {
+    throw std::logic_error("Le tiage a déja été réalisé");
+  }
+  pronostics_.add(std::move(owner), values);
+  return *this;
 }
 
 Lotto &Lotto::add(const Pronostic &pronostic) {
   if (has_draw()) {
     throw std::logic_error("Le tiage a déja été réalisé");
   }
-  pronostics_.push_back(pronostic);
+  pronostics_.add(pronostic);
+  return *this;
+}
+
+template<typename Range>
+Lotto &Lotto::add_bulk(Range &&range) {
+  if (has_draw()) {
+    throw std::logic_error("Le tiage a déja été réalisé");
+  }
+
+  using std::begin;
+  using std::end;
+  auto first{begin(range)};
+  auto last{end(range)};
+  pronostics_.reserve(pronostics_.size()
+                      + static_cast<std::size_t>(std::distance(first, last)));
+
+  for (; first != last; ++first) {
+    auto &&e{*first};
+    if constexpr (std::is_rvalue_reference_v<Range &&>) {
+      pronostics_.add(std::move(std::get<0>(e)), std::get<1>(e));
+    } else {
+      pronostics_.add(std::get<0>(e), std::get<1>(e));
+    }
+  }
+  return *this;
+}
+
+template<typename Range>
+ValidationReport Lotto::try_add_bulk(Range &&range, unsigned threads) {
+  if (has_draw()) {
+    throw std::logic_error("Le tiage a déja été réalisé");
+  }
+
+  auto report{validate(range, parameter_, threads)};
+  pronostics_.reserve(pronostics_.size() + report.count
+                      - report.invalid.size());
+
+  using std::begin;
+  auto first{begin(range)};
+  for (std::size_t i{0}; i < report.count; ++i) {
+    if (!report.valid(i)) {
+      continue;
+    }
+    auto &&e{first[i]};
+    if constexpr (std::is_rvalue_reference_v<Range &&>) {
+      pronostics_.add(std::move(std::get<0>(e)), std::get<1>(e));
+    } else {
+      pronostics_.add(std::get<0>(e), std::get<1>(e));
+    }
+  }
+  return report;
 }
 
 Lotto &Lotto::operator+=(const Pronostic &pronostic) {
@@ -401,40 +843,273 @@ Draw Lotto::draw() const {
 
 std::vector<Pronostic>
 Lotto::winner(unsigned predicted_length, Equality type) const {
-  // TODO
+  if (!has_draw()) {
+    throw std::logic_error("Le tirage n'a pas encore été réalisé.");
+  }
+  if (predicted_length == 0 || predicted_length > parameter_.length()) {
+    throw std::invalid_argument{"predicted length error"};
+  }
+
+  auto accept{[predicted_length, type](unsigned matches) {
+    return type == Equality::STRICT ? matches == predicted_length
+                                    : matches >= predicted_length;
+  }};
+  std::vector<Pronostic> result;
+
+  if (pronostics_.bitmask()) {
+    // par blocs, pour que les compteurs restent dans le cache L1
+    const auto &masks{pronostics_.masks()};
+    constexpr std::size_t BLOCK{4096};
+    std::array<unsigned char, BLOCK> counts;
+    for (std::size_t first{0}; first < masks.size(); first += BLOCK) {
+      auto count{std::min(BLOCK, masks.size() - first)};
+      matches(masks.data() + first, count, draw_->values().mask(),
+              counts.data());
+      for (std::size_t i{0}; i < count; ++i) {
+        if (accept(counts[i])) {
+          result.push_back(pronostics_[first + i]);
+        }
+      }
+    }
+  } else {
+    for (std::size_t i{0}; i < pronostics_.size(); ++i) {
+      if (accept(pronostics_.matches(i, draw_->values()))) {
+        result.push_back(pronostics_[i]);
+      }
+    }
+  }
+
+  return result;
 }
 
-std::string Lotto::to_string() const {
-  std::string result{"{ g } "};
-  result
-      .append(parameter_.to_string())
-      .append("\n");
+void Lotto::match_range(std::size_t first, std::size_t last,
+                        unsigned long long *counts,
+                        std::vector<std::vector<std::size_t>> *winners,
+                        unsigned minimum_level) const {
+  auto record{[counts, winners, minimum_level](std::size_t index,
+                                               unsigned matches) {
+    ++counts[matches];
+    if (winners != nullptr && matches >= minimum_level) {
+      (*winners)[matches].push_back(index);
+    }
+  }};
+
+  if (winners == nullptr && pronostics_.bitmask()
+      && with_preset(parameter_, [&](auto preset) {
+           preset.histogram(pronostics_.masks().data() + first,
+                            last - first, draw_->values().mask(), counts);
+         })) {
+    return;
+  }
+
+  if (pronostics_.bitmask()) {
+    constexpr std::size_t BLOCK{4096};
+    std::array<unsigned char, BLOCK> block;
+    for (; first < last; first += BLOCK) {
+      auto count{std::min(BLOCK, last - first)};
+      matches(pronostics_.masks().data() + first, count,
+              draw_->values().mask(), block.data());
+      for (std::size_t i{0}; i < count; ++i) {
+        record(first + i, block[i]);
+      }
+    }
+  } else {
+    for (; first < last; ++first) {
+      record(first, pronostics_.matches(first, draw_->values()));
+    }
+  }
+}
+
+std::vector<unsigned long long>
+Lotto::parallel_match(std::vector<std::vector<std::size_t>> *winners,
+                      unsigned minimum_level, unsigned threads) const {
+  if (!has_draw()) {
+    throw std::logic_error("Le tirage n'a pas encore été réalisé.");
+  }
+  threads = thread_count(threads);
+
+  const std::size_t levels{parameter_.length() + 1};
+  std::vector<std::vector<std::vector<std::size_t>>>
+      partials(winners == nullptr ? 0 : threads,
+               std::vector<std::vector<std::size_t>>(levels));
+  auto counts{parallel_histogram(
+      pronostics_.size(), levels, threads,
+      [&](unsigned t, std::size_t first, std::size_t last,
+          unsigned long long *local) {
+        match_range(first, last, local,
+                    winners == nullptr ? nullptr : &partials[t],
+                    minimum_level);
+      })};
+
+  if (winners != nullptr) {
+    winners->assign(levels, {});
+    for (std::size_t k{minimum_level}; k < levels; ++k) {
+      std::size_t total{0};
+      for (const auto &partial : partials) {
+        total += partial[k].size();
+      }
+      (*winners)[k].reserve(total);
+      for (const auto &partial : partials) {
+        (*winners)[k].insert(std::end((*winners)[k]),
+                             std::begin(partial[k]),
+                             std::end(partial[k]));
+      }
+    }
+  }
+
+  return counts;
+}
+
+std::vector<unsigned long long>
+Lotto::match_histogram(unsigned threads) const {
+  return parallel_match(nullptr, 0, threads);
+}
+
+std::vector<unsigned long long>
+Lotto::match_histogram(std::vector<std::vector<std::size_t>> &winners,
+                       unsigned minimum_level, unsigned threads) const {
+  return parallel_match(&winners, minimum_level, threads);
+}
+
+DistinctGrids Lotto::distinct(unsigned threads) const {
+  return DistinctGrids{pronostics_, threads};
+}
+
+std::vector<unsigned long long>
+Lotto::match_histogram(const DistinctGrids &distinct,
+                       unsigned threads) const {
+  if (!has_draw()) {
+    throw std::logic_error("Le tirage n'a pas encore été réalisé.");
+  }
+  if (distinct.pronostic_count() != pronostics_.size()) {
+    throw std::invalid_argument{"distinct grids size error"};
+  }
+  return distinct.match_histogram(draw_->values(), threads);
+}
+
+CoverageTable Lotto::coverage(unsigned threads) const {
+  return CoverageTable{distinct(threads), threads};
+}
+
+SimulationResult Lotto::simulate(std::size_t draws,
+                                 const nvs::seed &seed,
+                                 unsigned threads) const {
+  return lotto::simulate(pronostics_, draws, seed, threads);
+}
+
+const std::vector<std::size_t> &
+Lotto::pronostics_of(const std::string &owner) const {
+  static const std::vector<std::size_t> none;
+  auto id{pronostics_.find_owner(owner)};
+  return id ? pronostics_.pronostics_of(*id) : none;
+}
+
+OwnerSummary Lotto::summary(const std::string &owner) const {
+  const auto &indices{pronostics_of(owner)};
+  OwnerSummary result{indices.size(), std::nullopt};
+  if (has_draw() && !indices.empty()) {
+    unsigned best{0};
+    for (auto i : indices) {
+      best = std::max(best, pronostics_.matches(i, draw_->values()));
+    }
+    result.best_match = best;
+  }
+  return result;
+}
+
+std::vector<OwnerSummary> Lotto::summaries(unsigned threads) const {
+  std::vector<OwnerSummary> result(pronostics_.owners().size());
+  for (std::size_t id{0}; id < result.size(); ++id) {
+    result[id].grids = pronostics_.pronostics_of(
+        static_cast<std::uint32_t>(id)).size();
+  }
+  if (!has_draw()) {
+    return result;
+  }
+
+  // en masques, une grille compte au plus MASK_BITS_ valeurs : un
+  // octet suffit pour le niveau de chaque pronostic. En valeurs
+  // triées, le niveau peut dépasser 255 et chaque thread garde
+  // directement le meilleur niveau de ses propriétaires.
+  static_assert(Grid::MASK_BITS_ <= std::numeric_limits<unsigned char>::max(),
+                "niveau d'une grille en masques sur un octet");
+  const std::size_t size{pronostics_.size()};
+  const std::size_t owners{result.size()};
+  std::vector<unsigned char> levels(pronostics_.bitmask() ? size : 0);
+  std::vector<unsigned> best(owners);
+  parallel_for(pronostics_.bitmask() ? size : owners, threads,
+               [&](unsigned, std::size_t first, std::size_t last) {
+    if (pronostics_.bitmask()) {
+      matches(pronostics_.masks().data() + first, last - first,
+              draw_->values().mask(), levels.data() + first);
+    } else {
+      for (auto id{first}; id < last; ++id) {
+        for (auto i : pronostics_.pronostics_of(
+                 static_cast<std::uint32_t>(id))) {
+          best[id] = std::max(best[id],
+                              pronostics_.matches(i, draw_->values()));
+        }
+      }
+    }
+  });
+
+  for (std::size_t i{0}; i < levels.size(); ++i) {
+    auto &level{best[pronostics_.owner_id(i)]};
+    level = std::max<unsigned>(level, levels[i]);
+  }
+  for (std::size_t id{0}; id < result.size(); ++id) {
+    result[id].best_match = best[id];
+  }
+  return result;
+}
+
+template<typename Flush>
+void Lotto::format(std::string &buffer, Flush flush,
+                   std::size_t limit) const {
+  buffer.append("{ g } ");
+  parameter_.write(buffer);
+  buffer.push_back('\n');
 
   if (has_draw()) {
     // ici tirage a eu lieu
-    result
-        .append("{ d } ")
-        .append(draw_->to_string())
-        .append("\n");
-
-    result
-        .append("{ p } ")
-        .append(std::to_string(pronostics_.size()))
-        .append("\n");
-    for (const auto &e : pronostics_) {
-      result
-          .append("      ")
-          .append(e.to_string())
-          .append("\n");
+    buffer.append("{ d } ");
+    draw_->write(buffer);
+    buffer.push_back('\n');
+
+    buffer.append("{ p } ");
+    append_number(buffer, pronostics_.size()).push_back('\n');
+    for (std::size_t i{0}; i < pronostics_.size(); ++i) {
+      buffer.append("      ");
+      pronostics_.write(i, buffer);
+      buffer.push_back('\n');
+      if (buffer.size() >= limit) {
+        flush(buffer);
+      }
     }
   } else {
     // ici pas encore de tirage
-    result.append("no draw yet");
+    buffer.append("no draw yet");
   }
+}
 
+std::string Lotto::to_string() const {
+  std::string result;
+  format(result, [](std::string &) {}, std::string::npos);
   return result;
 }
 
+void Lotto::write(std::ostream &out) const {
+  constexpr std::size_t LIMIT{1 << 16};
+  std::string buffer;
+  buffer.reserve(LIMIT + 256);
+  auto flush{[&out](std::string &full) {
+    out.write(full.data(), static_cast<std::streamsize>(full.size()));
+    full.clear();
+  }};
+  format(buffer, flush, LIMIT);
+  flush(buffer);
+}
+
 // implémentation fonctions inline
 
 std::string to_string(const Lotto &lotto) {
@@ -442,7 +1117,8 @@ std::string to_string(const Lotto &lotto) {
 }
 
 std::ostream &operator<<(std::ostream &out, const Lotto &lotto) {
-  return out << lotto.to_string();
+  lotto.write(out);
+  return out;
 }
 
 }
@@ -0,0 +1,141 @@
+/**
+ * @file parallel.hpp
+ * @brief Définition des fonctions de répartition d'un travail
+ *        entre threads.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <vector>
+#include <thread>
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+// prototypes
+
+/*!
+ * \brief Nombre de threads effectif.
+ *
+ * \param threads nombre de threads demandé, 0 pour le nombre de
+ *                cœurs.
+ *
+ * \return `threads`, ou le nombre de cœurs (au moins 1) si
+ *         `threads` est nul.
+ */
+inline unsigned thread_count(unsigned threads);
+
+/*!
+ * \brief Exécution d'une fonction par plusieurs threads.
+ *
+ * `function(t)` est appelée une fois pour chaque `t` de 0 à
+ * `threads - 1` : l'appel 0 se fait dans le thread appelant, les
+ * autres dans autant de nouveaux threads, tous attendus avant le
+ * retour.
+ *
+ * \param threads nombre de threads, au moins 1.
+ * \param function fonction appelée avec le numéro du thread.
+ */
+template<typename Function>
+inline void run_threads(unsigned threads, Function function);
+
+/*!
+ * \brief Répartition d'un intervalle d'indices en plages
+ *        contiguës, une par thread.
+ *
+ * Le thread `t` reçoit la plage [`size * t / threads`,
+ * `size * (t + 1) / threads`[ : le découpage ne dépend que de
+ * `size` et `threads`. Il n'y a jamais plus de threads que
+ * d'indices.
+ *
+ * \param size nombre d'indices.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ * \param function fonction appelée avec le numéro du thread et
+ *                 les bornes de sa plage, `function(t, first,
+ *                 last)`.
+ */
+template<typename Function>
+inline void parallel_for(std::size_t size, unsigned threads,
+                         Function function);
+
+/*!
+ * \brief Histogramme calculé par plages en parallèle.
+ *
+ * Chaque thread remplit ses propres compteurs, additionnés à la
+ * fin : aucun compteur n'est partagé pendant le calcul.
+ *
+ * \param size nombre d'indices.
+ * \param levels nombre de compteurs.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ * \param function fonction appelée comme par parallel_for(), avec
+ *                 en plus les `levels` compteurs du thread à
+ *                 incrémenter, `function(t, first, last, counts)`.
+ *
+ * \return la somme des compteurs des threads.
+ */
+template<typename Function>
+inline std::vector<unsigned long long>
+parallel_histogram(std::size_t size, std::size_t levels, unsigned threads,
+                   Function function);
+
+// implémentation fonctions inline
+
+unsigned thread_count(unsigned threads) {
+  return threads != 0 ? threads
+                      : std::max(1u, std::thread::hardware_concurrency());
+}
+
+template<typename Function>
+void run_threads(unsigned threads, Function function) {
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (unsigned t{1}; t < threads; ++t) {
+    workers.emplace_back(function, t);
+  }
+  function(0u);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+template<typename Function>
+void parallel_for(std::size_t size, unsigned threads, Function function) {
+  threads = static_cast<unsigned>(std::min<std::size_t>(
+      thread_count(threads), std::max<std::size_t>(size, 1)));
+  run_threads(threads, [size, threads, &function](unsigned t) {
+    function(t, size * t / threads, size * (t + 1) / threads);
+  });
+}
+
+template<typename Function>
+std::vector<unsigned long long>
+parallel_histogram(std::size_t size, std::size_t levels, unsigned threads,
+                   Function function) {
+  threads = thread_count(threads);
+  std::vector<std::vector<unsigned long long>>
+      counts(threads, std::vector<unsigned long long>(levels));
+  parallel_for(size, threads,
+               [&counts, &function](unsigned t, std::size_t first,
+                                    std::size_t last) {
+                 function(t, first, last, counts[t].data());
+               });
+
+  for (unsigned t{1}; t < threads; ++t) {
+    for (std::size_t k{0}; k < levels; ++k) {
+      counts[0][k] += counts[t][k];
+    }
+  }
+  return std::move(counts[0]);
+}
+
+}
+
+#endif // PARALLEL_H
@@ -8,6 +8,7 @@
 #define PARAMETER_H
 
 #include <string>
+#include <charconv>
 #include <ostream>
 #include <stdexcept>
 
@@ -152,6 +153,16 @@ namespace g54327::lotto
        * \see to_string(const Parameter &)
        */
       inline std::string to_string() const;
+
+      /*!
+       * \brief Écriture d'un Parameter à la fin d'un tampon.
+       *
+       * Même mise en forme que to_string(), sans std::string
+       * intermédiaire.
+       *
+       * \param out tampon à compléter.
+       */
+      inline void write(std::string & out) const;
     };
 
 // prototypes
@@ -172,6 +183,20 @@ namespace g54327::lotto
  */
     inline std::string to_string(const Parameter & parameter);
 
+/*!
+ * \brief Écriture d'un entier à la fin d'un tampon.
+ *
+ * Le nombre est mis en forme par `std::to_chars`, sans
+ * allocation ni prise en compte de la locale.
+ *
+ * \param out tampon à compléter.
+ * \param value valeur à écrire.
+ *
+ * \return `out`.
+ */
+    inline std::string & append_number(std::string & out,
+    unsigned long long value);
+
 /*!
  * \brief Opérateur d'injection d'un Parameter dans un flux en
  *        sortie.
@@ -232,12 +257,16 @@ namespace g54327::lotto
 
     std::string Parameter::to_string() const
     {
-      return std::to_string(length_)
-          .append(" : [")
-          .append(std::to_string(minimum_))
-          .append("..")
-          .append(std::to_string((maximum_)))
-          .append("]");
+      std::string result;
+      write(result);
+      return result;
+    }
+
+    void Parameter::write(std::string & out) const
+    {
+      append_number(out, length_).append(" : [");
+      append_number(out, minimum_).append("..");
+      append_number(out, maximum_).append("]");
     }
 
 // implémentation fonctions inline
@@ -247,6 +276,14 @@ namespace g54327::lotto
       return parameter.to_string();
     }
 
+    std::string & append_number(std::string & out,
+    unsigned long long value)
+    {
+      char digits[20];
+      auto end { std::to_chars(digits, digits + sizeof(digits), value).ptr };
+      return out.append(digits, end);
+    }
+
     std::ostream & operator<<(std::ostream & out,
     const Parameter & parameter)
     {
@@ -0,0 +1,172 @@
+/**
+ * @file preset.hpp
+ * @brief Définition des paramétrages de lotto fixés à la
+ *        compilation et de leurs noyaux de comparaison.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef PRESET_H
+#define PRESET_H
+
+#include "grid.hpp"
+#include "parameter.hpp"
+
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Paramétrage de lotto connu à la compilation.
+ *
+ * Un Parameter ne peut pas être argument de template en C++17 :
+ * ses trois valeurs le sont à sa place. La taille de la grille, le
+ * nombre de mots utiles du masque et le nombre de niveaux de
+ * correspondance deviennent des constantes, ce qui permet au
+ * compilateur de dérouler et de vectoriser les boucles de
+ * comparaison et de vérification. Quand le maximum est inférieur
+ * à 64, seul le premier mot du masque est lu.
+ *
+ * \see with_preset()
+ */
+template<unsigned Length, unsigned Maximum, unsigned Minimum>
+struct Preset {
+  static_assert(Maximum < Grid::MASK_BITS_,
+                "un Preset ne couvre que les grilles en masque");
+
+  /*!
+   * \brief Paramétrage équivalent, vérifié à la compilation.
+   */
+  static constexpr Parameter PARAMETER_{Length, Maximum, Minimum};
+
+  /*!
+   * \brief Nombre de mots utiles d'un masque.
+   */
+  static constexpr std::size_t WORDS_{Maximum / 64 + 1};
+
+  /*!
+   * \brief Nombre de niveaux de correspondance, de 0 à `Length`.
+   */
+  static constexpr std::size_t LEVELS_{Length + 1};
+
+  /*!
+   * \brief Correspondance avec un paramétrage connu à l'exécution.
+   *
+   * \param parameter paramétrage à comparer.
+   *
+   * \return `true` si `parameter` a les mêmes valeurs que ce
+   *         Preset.
+   */
+  static constexpr bool is(const Parameter &parameter) {
+    return parameter.length() == Length
+           && parameter.maximum() == Maximum
+           && parameter.minimum() == Minimum;
+  }
+
+  /*!
+   * \brief Nombre de valeurs communes entre deux masques.
+   *
+   * \param mask masque d'une grille.
+   * \param draw masque du tirage.
+   *
+   * \return le nombre de bits à 1 communs aux deux masques.
+   */
+  static unsigned matches(const Grid::mask_type &mask,
+                          const Grid::mask_type &draw) {
+    unsigned result{0};
+    for (std::size_t w{0}; w < WORDS_; ++w) {
+      result += popcount(mask[w] & draw[w]);
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Version de g54327::lotto::matches() pour ce
+   *        paramétrage.
+   *
+   * \param masks tableau de `count` masques.
+   * \param count nombre de masques.
+   * \param draw masque comparé à chacun des masques.
+   * \param result tableau de `count` résultats.
+   */
+  static void matches(const Grid::mask_type *masks, std::size_t count,
+                      const Grid::mask_type &draw, unsigned char *result) {
+    for (std::size_t i{0}; i < count; ++i) {
+      result[i] = static_cast<unsigned char>(matches(masks[i], draw));
+    }
+  }
+
+  /*!
+   * \brief Comptage par niveau des valeurs communes entre un masque
+   *        et chaque masque d'un tableau contigu.
+   *
+   * La comparaison et le comptage sont faits en une passe, sans
+   * tableau intermédiaire, par g54327::lotto::histogram() sur
+   * des compteurs de taille fixe.
+   *
+   * \param masks tableau de `count` masques.
+   * \param count nombre de masques.
+   * \param draw masque comparé à chacun des masques.
+   * \param counts compteurs, un par niveau, incrémentés.
+   */
+  static void histogram(const Grid::mask_type *masks, std::size_t count,
+                        const Grid::mask_type &draw,
+                        unsigned long long *counts) {
+    std::array<unsigned long long, 4 * LEVELS_> lanes;
+    lotto::histogram(count,
+                     [masks, &draw](std::size_t i) {
+                       return matches(masks[i], draw);
+                     },
+                     LEVELS_, lanes.data(), counts);
+  }
+};
+
+/*!
+ * \brief Paramétrages usuels ayant leurs noyaux dédiés.
+ *
+ * Le paramétrage par défaut de Parameter (8 valeurs de 1 à 50) et
+ * ceux des principaux lottos : 6 parmi 45, 6 parmi 49 et 5 parmi
+ * 50.
+ */
+using Presets = std::tuple<Preset<8, 50, 1>,
+                           Preset<6, 45, 1>,
+                           Preset<6, 49, 1>,
+                           Preset<5, 50, 1>>;
+
+// prototypes
+
+/*!
+ * \brief Aiguillage vers le Preset d'un paramétrage.
+ *
+ * Si `parameter` correspond à l'un des Presets, `function` est
+ * appelée avec une instance de ce Preset, dont le type donne accès
+ * aux noyaux spécialisés. Sinon, rien n'est fait et l'appelant
+ * prend son chemin générique.
+ *
+ * \param parameter paramétrage connu à l'exécution.
+ * \param function appelable générique, de paramètre `auto`.
+ *
+ * \return `true` si `function` a été appelée.
+ */
+template<typename Function>
+inline bool with_preset(const Parameter &parameter, Function &&function);
+
+// implémentation fonctions inline
+
+template<typename Function>
+bool with_preset(const Parameter &parameter, Function &&function) {
+  return std::apply([&](auto... presets) {
+    return ((decltype(presets)::is(parameter)
+             && (function(presets), true)) || ...);
+  }, Presets{});
+}
+
+}
+
+#endif // PRESET_H
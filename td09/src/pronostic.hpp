@@ -13,7 +13,7 @@
 
 #include <string>
 #include <initializer_list>
-#include <set>
+#include <vector>
 
 /*!
  * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
@@ -151,6 +151,16 @@ class Pronostic : public Item {
    * \see to_string(const Pronostic &)
    */
   inline std::string to_string() const override;
+
+  /*!
+   * \brief Écriture d'un Pronostic à la fin d'un tampon.
+   *
+   * Même mise en forme que to_string(), sans std::string
+   * intermédiaire.
+   *
+   * \param out tampon à compléter.
+   */
+  inline void write(std::string &out) const override;
 };
 
 // implémentation méthodes inline
@@ -167,23 +177,30 @@ Pronostic::Pronostic(const std::string &owner,
                      const std::initializer_list<T> &values,
                      const Parameter &parameter) :
     Pronostic(owner,
-              std::set<unsigned>{cbegin(values),
-                                 cend(values)}, parameter) {}
+              std::vector<unsigned>{cbegin(values),
+                                    cend(values)}, parameter) {}
 
 template<typename T, std::size_t N>
 Pronostic::Pronostic(const std::string &owner,
                      const T (&values)[N],
                      const Parameter &parameter) :
     Pronostic(owner,
-              std::set<unsigned>{std::cbegin(values),
-                                 std::cend(values)}, parameter) {}
+              std::vector<unsigned>{std::cbegin(values),
+                                    std::cend(values)}, parameter) {}
 
 const std::string &Pronostic::owner() const {
   return owner_;
 }
 
 std::string Pronostic::to_string() const {
-  return Item::to_string().append(" ::: ").append(owner_);
+  std::string result;
+  write(result);
+  return result;
+}
+
+void Pronostic::write(std::string &out) const {
+  Item::write(out);
+  out.append(" ::: ").append(owner_);
 }
 
 }
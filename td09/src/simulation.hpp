@@ -0,0 +1,301 @@
+/**
+ * @file simulation.hpp
+ * @brief Définition de la simulation de Monte-Carlo de nombreux
+ *        tirages contre un même ensemble de pronostics.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "draw.hpp"
+#include "grid.hpp"
+#include "store.hpp"
+#include "preset.hpp"
+#include "parallel.hpp"
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "../resources/random.hpp"
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Distribution, sur l'ensemble des tirages simulés, du
+ *        nombre de pronostics d'un niveau de correspondance.
+ */
+struct LevelStatistics {
+  /*!
+   * \brief Nombre moyen de pronostics par tirage.
+   */
+  double mean;
+
+  /*!
+   * \brief Écart type du nombre de pronostics par tirage.
+   */
+  double stddev;
+
+  /*!
+   * \brief Plus petit nombre de pronostics d'un tirage.
+   */
+  unsigned long long minimum;
+
+  /*!
+   * \brief Plus grand nombre de pronostics d'un tirage.
+   */
+  unsigned long long maximum;
+
+  /*!
+   * \brief Proportion des tirages ayant au moins un pronostic
+   *        de ce niveau.
+   */
+  double hit_rate;
+};
+
+/*!
+ * \brief Résultat d'une simulation de plusieurs tirages.
+ *
+ * Pour le tirage d'indice `d`, `histograms[d * levels() + k]` est
+ * le nombre de pronostics ayant exactement `k` valeurs communes
+ * avec ce tirage, et `values[d * length]` à
+ * `values[(d + 1) * length - 1]` sont les valeurs tirées.
+ *
+ * \see simulate()
+ */
+struct SimulationResult {
+  /*!
+   * \brief Nombre de valeurs d'un tirage.
+   */
+  unsigned length;
+
+  /*!
+   * \brief Nombre de tirages simulés.
+   */
+  std::size_t draws;
+
+  /*!
+   * \brief Valeurs des tirages, triées, tirage par tirage.
+   */
+  std::vector<unsigned> values;
+
+  /*!
+   * \brief Histogrammes des niveaux de correspondance, tirage
+   *        par tirage.
+   */
+  std::vector<unsigned long long> histograms;
+
+  /*!
+   * \brief Nombre de niveaux de correspondance, de 0 à
+   *        \ref length.
+   *
+   * \return `length + 1`.
+   */
+  std::size_t levels() const {
+    return std::size_t{length} + 1;
+  }
+
+  /*!
+   * \brief Histogramme d'un tirage.
+   *
+   * \param draw indice du tirage.
+   *
+   * \return pointeur vers les levels() compteurs du tirage.
+   */
+  const unsigned long long *histogram(std::size_t draw) const {
+    return histograms.data() + draw * levels();
+  }
+
+  /*!
+   * \brief Valeurs d'un tirage.
+   *
+   * \param draw indice du tirage.
+   *
+   * \return pointeur vers les \ref length valeurs du tirage.
+   */
+  const unsigned *draw_values(std::size_t draw) const {
+    return values.data() + draw * length;
+  }
+
+  /*!
+   * \brief Distribution d'un niveau sur l'ensemble des tirages.
+   *
+   * \param level niveau de correspondance, de 0 à \ref length.
+   *
+   * \return moyenne, écart type, extrêmes et proportion de
+   *         tirages touchés ; tout à 0 s'il n'y a pas de tirage.
+   */
+  inline LevelStatistics statistics(unsigned level) const;
+
+  /*!
+   * \brief Distribution de chaque niveau.
+   *
+   * \return les statistics() des niveaux 0 à \ref length.
+   */
+  inline std::vector<LevelStatistics> statistics() const;
+};
+
+/*!
+ * \brief Bit du numéro de flux réservé aux tirages simulés.
+ *
+ * nvs::lotto::data() fait démarrer son bloc `d` à la même
+ * position du flux de sa graine que le tirage `d` de simulate().
+ * Les tirages utilisent donc le flux `seed.stream` ^
+ * SIMULATION_STREAM : générer des pronostics et simuler des
+ * tirages avec une même graine ne rejoue pas les mêmes nombres.
+ */
+constexpr std::uint64_t SIMULATION_STREAM{std::uint64_t{1} << 63};
+
+// prototypes
+
+/*!
+ * \brief Simulation de plusieurs tirages indépendants contre les
+ *        mêmes pronostics.
+ *
+ * Le tirage d'indice `d` est un Draw produit par le générateur
+ * nvs::urng() du flux `seed.stream` ^ \ref SIMULATION_STREAM,
+ * avancé de `d` fois un écart fixe : le résultat
+ * ne dépend donc ni du nombre de threads, ni de leur
+ * ordonnancement. Les tirages sont répartis en plages contiguës,
+ * une par thread. Chaque thread parcourt les masques par blocs et
+ * compare chaque bloc à plusieurs de ses tirages à la suite, pour
+ * qu'un même bloc serve plusieurs fois avant d'être évincé du
+ * cache. `store` n'est que lu.
+ *
+ * \param store pronostics à comparer aux tirages.
+ * \param draws nombre de tirages.
+ * \param seed graine des tirages.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ *
+ * \return les tirages et leurs histogrammes.
+ */
+inline SimulationResult simulate(const PronosticStore &store,
+                                 std::size_t draws,
+                                 const nvs::seed &seed,
+                                 unsigned threads = 0);
+
+// implémentation méthodes inline
+
+LevelStatistics SimulationResult::statistics(unsigned level) const {
+  LevelStatistics result{0, 0, 0, 0, 0};
+  if (draws == 0) {
+    return result;
+  }
+
+  double sum{0};
+  double squares{0};
+  std::size_t hits{0};
+  result.minimum = histogram(0)[level];
+  for (std::size_t d{0}; d < draws; ++d) {
+    auto count{histogram(d)[level]};
+    sum += static_cast<double>(count);
+    squares += static_cast<double>(count) * static_cast<double>(count);
+    result.minimum = std::min(result.minimum, count);
+    result.maximum = std::max(result.maximum, count);
+    if (count != 0) {
+      ++hits;
+    }
+  }
+
+  auto n{static_cast<double>(draws)};
+  result.mean = sum / n;
+  result.stddev = std::sqrt(std::max(0.0, squares / n
+                                              - result.mean * result.mean));
+  result.hit_rate = static_cast<double>(hits) / n;
+  return result;
+}
+
+std::vector<LevelStatistics> SimulationResult::statistics() const {
+  std::vector<LevelStatistics> result;
+  result.reserve(levels());
+  for (unsigned k{0}; k <= length; ++k) {
+    result.push_back(statistics(k));
+  }
+  return result;
+}
+
+// implémentation fonctions inline
+
+SimulationResult simulate(const PronosticStore &store, std::size_t draws,
+                          const nvs::seed &seed, unsigned threads) {
+  // écart entre les positions de départ de deux tirages successifs
+  // dans le flux du générateur, comme entre les blocs de
+  // nvs::lotto::data()
+  constexpr unsigned long long DRAW_STRIDE{1ull << 40};
+  const nvs::seed draw_seed{seed.value, seed.stream ^ SIMULATION_STREAM};
+  // nombre de masques d'un bloc, et de tirages comparés à la suite
+  // à un même bloc
+  constexpr std::size_t BLOCK{4096};
+  constexpr std::size_t BATCH{16};
+
+  const Parameter &parameter{store.parameter()};
+  SimulationResult result{parameter.length(), draws, {}, {}};
+  result.values.resize(draws * result.length);
+  result.histograms.resize(draws * result.levels());
+
+  const std::size_t size{store.size()};
+  const std::size_t levels{result.levels()};
+  parallel_for(draws, threads,
+               [&](unsigned, std::size_t first_draw, std::size_t last) {
+    for (auto first{first_draw}; first < last; first += BATCH) {
+      auto count{std::min(BATCH, last - first)};
+
+      std::vector<Draw> batch;
+      batch.reserve(count);
+      for (std::size_t d{first}; d < first + count; ++d) {
+        auto engine{nvs::urng(draw_seed)};
+        engine.discard(d * DRAW_STRIDE);
+        batch.emplace_back(parameter, engine);
+        std::copy(cbegin(batch.back().values()),
+                  cend(batch.back().values()),
+                  std::begin(result.values) + d * result.length);
+      }
+
+      if (store.bitmask()) {
+        std::array<unsigned char, BLOCK> block;
+        std::vector<unsigned> lanes(4 * levels);
+        for (std::size_t i{0}; i < size; i += BLOCK) {
+          auto masks{std::min(BLOCK, size - i)};
+          for (std::size_t d{0}; d < count; ++d) {
+            auto counts{result.histograms.data()
+                            + (first + d) * levels};
+            if (with_preset(parameter, [&](auto preset) {
+                  preset.histogram(store.masks().data() + i, masks,
+                                   batch[d].values().mask(), counts);
+                })) {
+              continue;
+            }
+
+            matches(store.masks().data() + i, masks,
+                    batch[d].values().mask(), block.data());
+            histogram(masks,
+                      [&block](std::size_t j) { return block[j]; },
+                      levels, lanes.data(), counts);
+          }
+        }
+      } else {
+        for (std::size_t d{0}; d < count; ++d) {
+          auto counts{result.histograms.data() + (first + d) * levels};
+          for (std::size_t i{0}; i < size; ++i) {
+            ++counts[store.matches(i, batch[d].values())];
+          }
+        }
+      }
+    }
+  });
+
+  return result;
+}
+
+}
+
+#endif // SIMULATION_H
@@ -0,0 +1,532 @@
+/**
+ * @file snapshot.hpp
+ * @brief Définition de la classe g54327::lotto::Snapshot.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "grid.hpp"
+#include "parameter.hpp"
+#include "store.hpp"
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Sauvegarde binaire d'un jeu de lotto.
+ *
+ * Le fichier reprend tel quel le rangement par colonnes de
+ * PronosticStore, dans l'ordre des octets de la machine :
+ *
+ *  1. un en-tête de 56 octets (voir Header) ;
+ *  2. les valeurs du tirage, s'il a eu lieu ;
+ *  3. les grilles : masques de 16 octets ou valeurs triées ;
+ *  4. l'identifiant du propriétaire de chaque pronostic ;
+ *  5. la table des propriétaires : `owner_count + 1` positions
+ *     de début, puis les caractères mis bout à bout.
+ *
+ * Chaque section commence à un multiple de 8 octets.
+ *
+ * L'écriture se fait en un seul appel à `std::fwrite`. La
+ * lecture projette le fichier en mémoire (`mmap`) et n'en
+ * vérifie que l'en-tête, la taille et la table des
+ * propriétaires ; les sections sont ensuite lues en place.
+ * Sous Windows, le fichier est lu en une fois dans un tampon.
+ *
+ * Lotto(const Snapshot &) ne sert pas le jeu depuis la
+ * projection : il recopie les colonnes dans un PronosticStore
+ * en un passage linéaire, qui contrôle chaque grille.
+ */
+class Snapshot {
+ public:
+  /*!
+   * \brief Version du format écrit par write().
+   */
+  static constexpr std::uint32_t VERSION_{1};
+
+  /*!
+   * \brief En-tête d'une sauvegarde.
+   */
+  struct Header {
+    /*! Signature `LOTTOSNP`. */
+    char magic[8];
+    /*! Version du format. */
+    std::uint32_t version;
+    /*! Bit 0 : tirage présent, bit 1 : grilles en masques. */
+    std::uint32_t flags;
+    /*! Nombre de valeurs d'une grille. */
+    std::uint32_t length;
+    /*! Valeur maximale d'une grille. */
+    std::uint32_t maximum;
+    /*! Valeur minimale d'une grille. */
+    std::uint32_t minimum;
+    /*! Inutilisé, à zéro. */
+    std::uint32_t reserved;
+    /*! Nombre de pronostics. */
+    std::uint64_t count;
+    /*! Nombre de propriétaires distincts. */
+    std::uint64_t owner_count;
+    /*! Nombre total de caractères des propriétaires. */
+    std::uint64_t owner_bytes;
+  };
+
+  static_assert(sizeof(Header) == 56, "en-tête sans remplissage");
+
+  /*!
+   * \brief Position de chaque section, en octets depuis le début
+   *        du fichier.
+   */
+  struct Layout {
+    std::size_t draw;
+    std::size_t grids;
+    std::size_t owner_ids;
+    std::size_t owner_offsets;
+    std::size_t owner_chars;
+    /*! Taille totale du fichier. */
+    std::size_t size;
+  };
+
+ private:
+  static constexpr char MAGIC_[8]{'L', 'O', 'T', 'T', 'O', 'S', 'N', 'P'};
+
+  static constexpr std::uint32_t HAS_DRAW_{1};
+
+  static constexpr std::uint32_t BITMASK_{2};
+
+  /*!
+   * \brief Début des données.
+   */
+  const unsigned char *data_;
+
+  /*!
+   * \brief Taille des données en octets.
+   */
+  std::size_t size_;
+
+#ifdef _WIN32
+  /*!
+   * \brief Tampon de lecture, aligné sur 8 octets.
+   */
+  std::vector<std::uint64_t> buffer_;
+#endif
+
+  /*!
+   * \brief Copie de l'en-tête.
+   */
+  Header header_;
+
+  /*!
+   * \brief Position de chaque section.
+   */
+  Layout layout_;
+
+  /*!
+   * \brief Arrondi au multiple de 8 supérieur.
+   */
+  static constexpr std::size_t align(std::size_t size) {
+    return (size + 7) / 8 * 8;
+  }
+
+  /*!
+   * \brief Somme de tailles lues dans un en-tête.
+   *
+   * \throw std::runtime_error si le résultat dépasse
+   *          `std::size_t`.
+   */
+  static inline std::size_t add(std::uint64_t lhs, std::uint64_t rhs);
+
+  /*!
+   * \brief Produit de tailles lues dans un en-tête.
+   *
+   * \throw std::runtime_error si le résultat dépasse
+   *          `std::size_t`.
+   */
+  static inline std::size_t multiply(std::uint64_t lhs, std::uint64_t rhs);
+
+  /*!
+   * \brief Calcul des positions des sections à partir de
+   *        l'en-tête.
+   *
+   * \param header en-tête d'une sauvegarde.
+   *
+   * \return position de chaque section et taille du fichier.
+   *
+   * \throw std::runtime_error si une taille de section dépasse
+   *          `std::size_t`, l'en-tête étant alors corrompu.
+   */
+  static inline Layout layout(const Header &header);
+
+  /*!
+   * \brief Libération de la projection.
+   */
+  inline void release();
+
+ public:
+
+  /*!
+   * \brief Ouverture d'une sauvegarde.
+   *
+   * \param path chemin du fichier.
+   *
+   * \throw std::runtime_error si le fichier ne peut être lu, ou
+   *          si son en-tête, sa taille ou sa table des
+   *          propriétaires ne correspondent pas au format.
+   */
+  inline explicit Snapshot(const std::string &path);
+
+  /*!
+   * \brief Destructeur, libère la projection.
+   */
+  inline ~Snapshot();
+
+  Snapshot(const Snapshot &) = delete;
+
+  Snapshot &operator=(const Snapshot &) = delete;
+
+  /*!
+   * \brief Écriture d'une sauvegarde.
+   *
+   * \param path chemin du fichier, écrasé s'il existe.
+   * \param pronostics pronostics à sauvegarder, dont le
+   *                   paramétrage est repris dans l'en-tête.
+   * \param draw tirage, ou `nullptr` s'il n'a pas eu lieu.
+   *
+   * \throw std::runtime_error si le fichier ne peut être écrit.
+   */
+  static inline void write(const std::string &path,
+                           const PronosticStore &pronostics,
+                           const Grid *draw);
+
+  /*!
+   * \brief Accesseur en lecture de l'en-tête.
+   */
+  inline const Header &header() const;
+
+  /*!
+   * \brief Paramétrage sauvegardé.
+   */
+  inline Parameter parameter() const;
+
+  /*!
+   * \brief Nombre de pronostics.
+   */
+  inline std::size_t size() const;
+
+  /*!
+   * \brief Présence du tirage.
+   */
+  inline bool has_draw() const;
+
+  /*!
+   * \brief Valeurs du tirage, `length` valeurs triées.
+   */
+  inline const std::uint32_t *draw() const;
+
+  /*!
+   * \brief Représentation des grilles.
+   *
+   * \return `true` si les grilles sont des masques.
+   */
+  inline bool bitmask() const;
+
+  /*!
+   * \brief Masques des grilles, si bitmask() est vrai.
+   */
+  inline const Grid::mask_type *masks() const;
+
+  /*!
+   * \brief Valeurs triées des grilles, si bitmask() est faux.
+   */
+  inline const std::uint32_t *values() const;
+
+  /*!
+   * \brief Identifiant du propriétaire de chaque pronostic.
+   */
+  inline const std::uint32_t *owner_ids() const;
+
+  /*!
+   * \brief Nombre de propriétaires distincts.
+   */
+  inline std::size_t owner_count() const;
+
+  /*!
+   * \brief Propriétaire d'identifiant donné.
+   *
+   * \param id identifiant, inférieur à owner_count().
+   *
+   * \return vue sur les caractères du propriétaire, valide tant
+   *         que la sauvegarde reste ouverte.
+   */
+  inline std::string_view owner(std::size_t id) const;
+};
+
+// implémentation méthodes inline
+
+std::size_t Snapshot::add(std::uint64_t lhs, std::uint64_t rhs) {
+  constexpr std::uint64_t max{std::numeric_limits<std::size_t>::max()};
+  if (lhs > max || rhs > max - lhs) {
+    throw std::runtime_error{"corrupted snapshot"};
+  }
+  return static_cast<std::size_t>(lhs + rhs);
+}
+
+std::size_t Snapshot::multiply(std::uint64_t lhs, std::uint64_t rhs) {
+  constexpr std::uint64_t max{std::numeric_limits<std::size_t>::max()};
+  if (lhs != 0 && rhs > max / lhs) {
+    throw std::runtime_error{"corrupted snapshot"};
+  }
+  return static_cast<std::size_t>(lhs * rhs);
+}
+
+Snapshot::Layout Snapshot::layout(const Header &header) {
+  const std::size_t length{header.length};
+  const std::uint64_t count{header.count};
+
+  // align() sans dépassement
+  auto section{[](std::uint64_t size) { return add(size, 7) / 8 * 8; }};
+
+  Layout result{};
+  result.draw = sizeof(Header);
+  result.grids = add(result.draw,
+                     (header.flags & HAS_DRAW_) != 0
+                     ? section(multiply(length, sizeof(std::uint32_t))) : 0);
+  result.owner_ids = add(result.grids,
+                         (header.flags & BITMASK_) != 0
+                         ? multiply(count, sizeof(Grid::mask_type))
+                         : section(multiply(multiply(count, length),
+                                            sizeof(std::uint32_t))));
+  result.owner_offsets = add(result.owner_ids,
+                             section(multiply(count, sizeof(std::uint32_t))));
+  result.owner_chars = add(result.owner_offsets,
+                           multiply(add(header.owner_count, 1),
+                                    sizeof(std::uint64_t)));
+  result.size = add(result.owner_chars, section(header.owner_bytes));
+  return result;
+}
+
+void Snapshot::release() {
+#ifndef _WIN32
+  ::munmap(const_cast<unsigned char *>(data_), size_);
+#endif
+}
+
+Snapshot::Snapshot(const std::string &path) :
+    data_{nullptr},
+    size_{0},
+    header_{},
+    layout_{} {
+#ifdef _WIN32
+  std::ifstream in{path, std::ios::binary | std::ios::ate};
+  if (!in) {
+    throw std::runtime_error{"cannot open " + path};
+  }
+  size_ = static_cast<std::size_t>(in.tellg());
+  buffer_.resize((size_ + 7) / 8);
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char *>(buffer_.data()),
+               static_cast<std::streamsize>(size_))) {
+    throw std::runtime_error{"cannot read " + path};
+  }
+  data_ = reinterpret_cast<const unsigned char *>(buffer_.data());
+#else
+  int file{::open(path.c_str(), O_RDONLY)};
+  if (file < 0) {
+    throw std::runtime_error{"cannot open " + path};
+  }
+  struct stat status{};
+  if (::fstat(file, &status) != 0) {
+    ::close(file);
+    throw std::runtime_error{"cannot stat " + path};
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  void *mapping{size_ == 0 ? MAP_FAILED
+                           : ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE,
+                                    file, 0)};
+  ::close(file);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error{"cannot map " + path};
+  }
+  data_ = static_cast<const unsigned char *>(mapping);
+#endif
+
+  try {
+    if (size_ < sizeof(Header)) {
+      throw std::runtime_error{"truncated snapshot " + path};
+    }
+    std::memcpy(&header_, data_, sizeof(Header));
+    if (std::memcmp(header_.magic, MAGIC_, sizeof(MAGIC_)) != 0) {
+      throw std::runtime_error{"not a lotto snapshot " + path};
+    }
+    if (header_.version != VERSION_) {
+      throw std::runtime_error{"unsupported snapshot version "
+                               + std::to_string(header_.version)};
+    }
+    if (((header_.flags & BITMASK_) != 0)
+        != (header_.maximum < Grid::MASK_BITS_)) {
+      throw std::runtime_error{"corrupted snapshot " + path};
+    }
+    layout_ = layout(header_);
+    if (layout_.size != size_) {
+      throw std::runtime_error{"truncated snapshot " + path};
+    }
+    // owner() lit les positions sans les contrôler
+    auto offsets{reinterpret_cast<const std::uint64_t *>(
+        data_ + layout_.owner_offsets)};
+    auto offsets_end{offsets + header_.owner_count + 1};
+    if (offsets[0] != 0 || offsets_end[-1] != header_.owner_bytes
+        || std::adjacent_find(offsets, offsets_end,
+                              std::greater<std::uint64_t>{})
+           != offsets_end) {
+      throw std::runtime_error{"corrupted snapshot " + path};
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+Snapshot::~Snapshot() {
+  release();
+}
+
+void Snapshot::write(const std::string &path,
+                     const PronosticStore &pronostics,
+                     const Grid *draw) {
+  static_assert(sizeof(unsigned) == sizeof(std::uint32_t),
+                "les valeurs sont sauvegardées sur 32 bits");
+
+  const auto &parameter{pronostics.parameter()};
+  const auto &owners{pronostics.owners()};
+  const std::size_t count{pronostics.size()};
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC_, sizeof(MAGIC_));
+  header.version = VERSION_;
+  header.flags = (draw != nullptr ? HAS_DRAW_ : 0)
+                 | (pronostics.bitmask() ? BITMASK_ : 0);
+  header.length = parameter.length();
+  header.maximum = parameter.maximum();
+  header.minimum = parameter.minimum();
+  header.count = count;
+  header.owner_count = owners.size();
+  for (const auto &owner : owners) {
+    header.owner_bytes += owner.size();
+  }
+
+  // tout le fichier est préparé en mémoire puis écrit d'un coup
+  const auto sections{layout(header)};
+  std::vector<std::uint64_t> buffer((sections.size + 7) / 8);
+  auto out{reinterpret_cast<unsigned char *>(buffer.data())};
+
+  std::memcpy(out, &header, sizeof(Header));
+  if (draw != nullptr) {
+    std::vector<unsigned> values(draw->begin(), draw->end());
+    std::memcpy(out + sections.draw, values.data(),
+                values.size() * sizeof(unsigned));
+  }
+  if (pronostics.bitmask()) {
+    std::memcpy(out + sections.grids, pronostics.masks().data(),
+                count * sizeof(Grid::mask_type));
+  } else {
+    std::memcpy(out + sections.grids, pronostics.values().data(),
+                pronostics.values().size() * sizeof(unsigned));
+  }
+  std::memcpy(out + sections.owner_ids, pronostics.owner_ids().data(),
+              count * sizeof(std::uint32_t));
+  auto offsets{reinterpret_cast<std::uint64_t *>(out + sections.owner_offsets)};
+  std::uint64_t offset{0};
+  for (std::size_t id{0}; id < owners.size(); ++id) {
+    offsets[id] = offset;
+    std::memcpy(out + sections.owner_chars + offset, owners[id].data(),
+                owners[id].size());
+    offset += owners[id].size();
+  }
+  offsets[owners.size()] = offset;
+
+  std::FILE *file{std::fopen(path.c_str(), "wb")};
+  if (file == nullptr) {
+    throw std::runtime_error{"cannot open " + path};
+  }
+  auto written{std::fwrite(out, 1, sections.size, file)};
+  if (std::fclose(file) != 0 || written != sections.size) {
+    throw std::runtime_error{"cannot write " + path};
+  }
+}
+
+const Snapshot::Header &Snapshot::header() const {
+  return header_;
+}
+
+Parameter Snapshot::parameter() const {
+  return Parameter{header_.length, header_.maximum, header_.minimum};
+}
+
+std::size_t Snapshot::size() const {
+  return static_cast<std::size_t>(header_.count);
+}
+
+bool Snapshot::has_draw() const {
+  return (header_.flags & HAS_DRAW_) != 0;
+}
+
+const std::uint32_t *Snapshot::draw() const {
+  return reinterpret_cast<const std::uint32_t *>(data_ + layout_.draw);
+}
+
+bool Snapshot::bitmask() const {
+  return (header_.flags & BITMASK_) != 0;
+}
+
+const Grid::mask_type *Snapshot::masks() const {
+  return reinterpret_cast<const Grid::mask_type *>(data_ + layout_.grids);
+}
+
+const std::uint32_t *Snapshot::values() const {
+  return reinterpret_cast<const std::uint32_t *>(data_ + layout_.grids);
+}
+
+const std::uint32_t *Snapshot::owner_ids() const {
+  return reinterpret_cast<const std::uint32_t *>(data_ + layout_.owner_ids);
+}
+
+std::size_t Snapshot::owner_count() const {
+  return static_cast<std::size_t>(header_.owner_count);
+}
+
+std::string_view Snapshot::owner(std::size_t id) const {
+  auto offsets{reinterpret_cast<const std::uint64_t *>(
+      data_ + layout_.owner_offsets)};
+  return {reinterpret_cast<const char *>(data_ + layout_.owner_chars)
+              + offsets[id],
+          static_cast<std::size_t>(offsets[id + 1] - offsets[id])};
+}
+
+}
+
+#endif // SNAPSHOT_H
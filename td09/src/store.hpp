@@ -0,0 +1,676 @@
+/**
+ * @file store.hpp
+ * @brief Définition de la classe g54327::lotto::PronosticStore.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef STORE_H
+#define STORE_H
+
+#include "grid.hpp"
+#include "parameter.hpp"
+#include "pronostic.hpp"
+
+#include <vector>
+#include <string>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Ensemble de pronostics rangés par colonnes.
+ *
+ * Plutôt qu'un std::vector de Pronostic, chacun avec son
+ * std::string, sa référence vers le paramétrage et sa table
+ * virtuelle, les pronostics sont rangés dans des tableaux
+ * contigus :
+ *
+ *  + les masques des grilles (voir Grid), 16 octets par
+ *    pronostic, ou leurs valeurs triées si la grille ne tient
+ *    pas dans un masque ;
+ *  + l'identifiant du propriétaire, 4 octets par pronostic.
+ *
+ * Chaque propriétaire n'est enregistré qu'une seule fois dans
+ * une table de std::string.
+ *
+ * Un Pronostic n'est reconstruit qu'à la demande, par
+ * operator[]() ou lors d'un parcours. Il fait alors référence au
+ * paramétrage de l'ensemble, qui doit donc lui survivre.
+ */
+class PronosticStore {
+ public:
+  class const_iterator;
+
+ private:
+  /*!
+   * \brief Paramétrage commun à tous les pronostics.
+   */
+  Parameter parameter_;
+
+  /*!
+   * \brief Masques des grilles, si elles tiennent dans un
+   *        masque.
+   */
+  std::vector<Grid::mask_type> masks_;
+
+  /*!
+   * \brief Valeurs triées des grilles, `parameter_.length()`
+   *        par pronostic, si elles ne tiennent pas dans un
+   *        masque.
+   */
+  std::vector<unsigned> values_;
+
+  /*!
+   * \brief Identifiant du propriétaire de chaque pronostic.
+   */
+  std::vector<std::uint32_t> owner_ids_;
+
+  /*!
+   * \brief Table des propriétaires, indicée par identifiant.
+   */
+  std::vector<std::string> owners_;
+
+  /*!
+   * \brief Identifiant de chaque propriétaire de \ref owners_.
+   */
+  std::unordered_map<std::string, std::uint32_t> owner_index_;
+
+  /*!
+   * \brief Indices croissants des pronostics de chaque
+   *        propriétaire, par identifiant.
+   *
+   * Tenus à jour à chaque ajout.
+   */
+  std::vector<std::vector<std::size_t>> owner_pronostics_;
+
+  /*!
+   * \brief Vérification d'une grille.
+   *
+   * Les mêmes vérifications que Item::checkLengths() et
+   * Item::checkValues(), avec les mêmes messages.
+   *
+   * \param grid grille à vérifier.
+   *
+   * \throw std::invalid_argument si la grille ne respecte pas
+   *          \ref parameter_.
+   */
+  inline void check(const Grid &grid) const;
+
+  /*!
+   * \brief Identifiant d'un propriétaire.
+   *
+   * Un propriétaire inconnu est ajouté à la table. S'il s'agit
+   * d'une rvalue, la std::string est déplacée dans l'index : un
+   * propriétaire n'y est copié qu'une fois, dans \ref owners_.
+   *
+   * \param owner propriétaire.
+   *
+   * \return identifiant de `owner`.
+   */
+  template<typename String>
+  inline std::uint32_t intern(String &&owner);
+
+  /*!
+   * \brief Ajout d'une grille déjà vérifiée.
+   *
+   * \param owner_id identifiant du propriétaire.
+   * \param grid grille à ajouter.
+   */
+  inline void append(std::uint32_t owner_id, const Grid &grid);
+
+ public:
+
+  /*!
+   * \brief Constructeur d'un ensemble vide.
+   *
+   * \param parameter paramétrage des pronostics.
+   */
+  inline explicit PronosticStore(const Parameter &parameter);
+
+  /*!
+   * \brief Accesseur en lecture du paramétrage.
+   *
+   * \return paramétrage commun aux pronostics.
+   */
+  inline const Parameter &parameter() const;
+
+  /*!
+   * \brief Ajout d'un pronostic.
+   *
+   * Les valeurs sont vérifiées comme par le constructeur
+   * Item::Item(), sans construire de Pronostic. Les fonctions
+   * `cbegin()` et `cend()` sont recherchées dans l'espace de nom
+   * de `Container`, ou à défaut dans `std`.
+   *
+   * \param owner propriétaire du pronostic.
+   * \param values valeurs du pronostic.
+   *
+   * \return l'ensemble de pronostics.
+   *
+   * \throw std::invalid_argument si les valeurs ne respectent
+   *          pas le paramétrage.
+   */
+  template<typename Container>
+  inline PronosticStore &add(const std::string &owner,
+                             const Container &values);
+
+  /*!
+   * \brief Ajout d'un pronostic, le propriétaire étant déplacé.
+   *
+   * \see add(const std::string &, const Container &)
+   */
+  template<typename Container>
+  inline PronosticStore &add(std::string &&owner,
+                             const Container &values);
+
+  /*!
+   * \brief Ajout d'un pronostic existant.
+   *
+   * \param pronostic pronostic à ajouter.
+   *
+   * \return l'ensemble de pronostics.
+   *
+   * \throw std::invalid_argument si les valeurs du pronostic ne
+   *          respectent pas le paramétrage.
+   */
+  inline PronosticStore &add(const Pronostic &pronostic);
+
+  /*!
+   * \brief Réservation de place.
+   *
+   * \param count nombre total de pronostics prévus.
+   */
+  inline void reserve(std::size_t count);
+
+  /*!
+   * \brief Nombre de pronostics.
+   *
+   * \return le nombre de pronostics.
+   */
+  inline std::size_t size() const;
+
+  /*!
+   * \brief Ensemble vide ou non.
+   *
+   * \return `true` s'il n'y a aucun pronostic.
+   */
+  inline bool empty() const;
+
+  /*!
+   * \brief Représentation des grilles.
+   *
+   * \return `true` si les grilles sont rangées dans masks().
+   */
+  inline bool bitmask() const;
+
+  /*!
+   * \brief Masques des grilles.
+   *
+   * \return tableau contigu de size() masques, vide si
+   *         bitmask() est faux.
+   */
+  inline const std::vector<Grid::mask_type> &masks() const;
+
+  /*!
+   * \brief Valeurs triées des grilles.
+   *
+   * \return `parameter().length()` valeurs par pronostic, vide
+   *         si bitmask() est vrai.
+   */
+  inline const std::vector<unsigned> &values() const;
+
+  /*!
+   * \brief Identifiants des propriétaires.
+   *
+   * \return identifiant du propriétaire de chaque pronostic.
+   */
+  inline const std::vector<std::uint32_t> &owner_ids() const;
+
+  /*!
+   * \brief Remplacement du contenu par des colonnes existantes.
+   *
+   * Les grilles sont recopiées en un passage qui vérifie que
+   * chacune compte `parameter().length()` valeurs distinctes
+   * entre le minimum et le maximum : un masque doit avoir autant
+   * de bits levés, tous dans cet intervalle, et des valeurs
+   * doivent être strictement croissantes.
+   *
+   * \param grids `count` masques si bitmask() est vrai, sinon
+   *              `count * parameter().length()` valeurs triées.
+   * \param owner_ids `count` identifiants de propriétaires.
+   * \param count nombre de pronostics.
+   * \param owners table des propriétaires.
+   *
+   * \throw std::invalid_argument si un identifiant ne désigne
+   *          aucun propriétaire de `owners`.
+   * \throw std::runtime_error si une grille ne respecte pas le
+   *          paramétrage, les colonnes venant alors d'une
+   *          sauvegarde corrompue. Le contenu est inchangé.
+   */
+  inline void restore(const void *grids, const std::uint32_t *owner_ids,
+                      std::size_t count, std::vector<std::string> owners);
+
+  /*!
+   * \brief Grille d'un pronostic.
+   *
+   * \param index indice du pronostic.
+   *
+   * \return les valeurs du pronostic.
+   */
+  inline Grid grid(std::size_t index) const;
+
+  /*!
+   * \brief Identifiant du propriétaire d'un pronostic.
+   *
+   * \param index indice du pronostic.
+   *
+   * \return indice du propriétaire dans owners().
+   */
+  inline std::uint32_t owner_id(std::size_t index) const;
+
+  /*!
+   * \brief Propriétaire d'un pronostic.
+   *
+   * \param index indice du pronostic.
+   *
+   * \return le propriétaire du pronostic.
+   */
+  inline const std::string &owner(std::size_t index) const;
+
+  /*!
+   * \brief Table des propriétaires.
+   *
+   * \return les propriétaires distincts, par ordre de premier
+   *         ajout.
+   */
+  inline const std::vector<std::string> &owners() const;
+
+  /*!
+   * \brief Recherche d'un propriétaire.
+   *
+   * \param owner propriétaire recherché.
+   *
+   * \return son identifiant, ou rien s'il n'a aucun pronostic.
+   */
+  inline std::optional<std::uint32_t>
+  find_owner(const std::string &owner) const;
+
+  /*!
+   * \brief Pronostics d'un propriétaire.
+   *
+   * \param owner_id identifiant du propriétaire.
+   *
+   * \return indices croissants de ses pronostics.
+   */
+  inline const std::vector<std::size_t> &
+  pronostics_of(std::uint32_t owner_id) const;
+
+  /*!
+   * \brief Nombre de valeurs communes entre un pronostic et une
+   *        grille.
+   *
+   * \param index indice du pronostic.
+   * \param grid grille de comparaison.
+   *
+   * \return le nombre de valeurs présentes dans les deux.
+   */
+  inline unsigned matches(std::size_t index, const Grid &grid) const;
+
+  /*!
+   * \brief Reconstruction d'un pronostic.
+   *
+   * \param index indice du pronostic.
+   *
+   * \return le pronostic, associé à parameter().
+   */
+  inline Pronostic operator[](std::size_t index) const;
+
+  /*!
+   * \brief Écriture d'un pronostic à la fin d'un tampon.
+   *
+   * Même mise en forme que Pronostic::to_string(), mais écrite
+   * directement depuis les colonnes, sans reconstruire le
+   * Pronostic.
+   *
+   * \param index indice du pronostic.
+   * \param out tampon à compléter.
+   */
+  inline void write(std::size_t index, std::string &out) const;
+
+  /*!
+   * \brief Itérateur sur le premier pronostic.
+   *
+   * \return itérateur de début.
+   */
+  inline const_iterator begin() const;
+
+  /*!
+   * \brief Itérateur après le dernier pronostic.
+   *
+   * \return itérateur de fin.
+   */
+  inline const_iterator end() const;
+};
+
+/*!
+ * \brief Itérateur constant sur les pronostics d'un
+ *        PronosticStore.
+ *
+ * Chaque Pronostic est reconstruit au déréférencement et
+ * retourné par valeur.
+ */
+class PronosticStore::const_iterator {
+  const PronosticStore *store_;
+  std::size_t index_;
+
+  friend class PronosticStore;
+
+  inline const_iterator(const PronosticStore *store, std::size_t index);
+
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = Pronostic;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = Pronostic;
+
+  inline reference operator*() const;
+
+  inline const_iterator &operator++();
+
+  inline const_iterator operator++(int);
+
+  inline friend bool operator==(const const_iterator &lhs,
+                                const const_iterator &rhs);
+
+  inline friend bool operator!=(const const_iterator &lhs,
+                                const const_iterator &rhs);
+};
+
+// implémentation méthodes inline
+
+PronosticStore::PronosticStore(const Parameter &parameter) :
+    parameter_{parameter},
+    masks_{},
+    values_{},
+    owner_ids_{},
+    owners_{},
+    owner_index_{},
+    owner_pronostics_{} {}
+
+void PronosticStore::check(const Grid &grid) const {
+  if (parameter_.length() != grid.size()) {
+    throw std::invalid_argument{"size error"};
+  }
+  if (grid.empty()) {
+    return;
+  }
+  if (*grid.begin() < parameter_.minimum()
+      || *grid.rbegin() > parameter_.maximum()) {
+    throw std::invalid_argument{"value error"};
+  }
+}
+
+void PronosticStore::append(std::uint32_t owner_id, const Grid &grid) {
+  if (bitmask()) {
+    masks_.push_back(grid.mask());
+  } else {
+    values_.insert(std::end(values_), grid.begin(), grid.end());
+  }
+  owner_pronostics_[owner_id].push_back(owner_ids_.size());
+  owner_ids_.push_back(owner_id);
+}
+
+const Parameter &PronosticStore::parameter() const {
+  return parameter_;
+}
+
+template<typename String>
+std::uint32_t PronosticStore::intern(String &&owner) {
+  auto [position, inserted]{owner_index_.try_emplace(
+      std::forward<String>(owner),
+      static_cast<std::uint32_t>(owners_.size()))};
+  if (inserted) {
+    owners_.push_back(position->first);
+    owner_pronostics_.emplace_back();
+  }
+  return position->second;
+}
+
+template<typename Container>
+PronosticStore &PronosticStore::add(const std::string &owner,
+                                    const Container &values) {
+  using std::cbegin;
+  using std::cend;
+  Grid grid{cbegin(values), cend(values), parameter_.maximum()};
+  check(grid);
+  append(intern(owner), grid);
+  return *this;
+}
+
+template<typename Container>
+PronosticStore &PronosticStore::add(std::string &&owner,
+                                    const Container &values) {
+  using std::cbegin;
+  using std::cend;
+  Grid grid{cbegin(values), cend(values), parameter_.maximum()};
+  check(grid);
+  append(intern(std::move(owner)), grid);
+  return *this;
+}
+
+PronosticStore &PronosticStore::add(const Pronostic &pronostic) {
+  return add(pronostic.owner(), pronostic.values());
+}
+
+void PronosticStore::reserve(std::size_t count) {
+  if (bitmask()) {
+    masks_.reserve(count);
+  } else {
+    values_.reserve(count * parameter_.length());
+  }
+  owner_ids_.reserve(count);
+}
+
+std::size_t PronosticStore::size() const {
+  return owner_ids_.size();
+}
+
+bool PronosticStore::empty() const {
+  return owner_ids_.empty();
+}
+
+bool PronosticStore::bitmask() const {
+  return parameter_.maximum() < Grid::MASK_BITS_;
+}
+
+const std::vector<Grid::mask_type> &PronosticStore::masks() const {
+  return masks_;
+}
+
+Grid PronosticStore::grid(std::size_t index) const {
+  if (bitmask()) {
+    return Grid{masks_[index]};
+  }
+  auto first{std::cbegin(values_) + index * parameter_.length()};
+  return {first, first + parameter_.length(), parameter_.maximum()};
+}
+
+const std::vector<unsigned> &PronosticStore::values() const {
+  return values_;
+}
+
+const std::vector<std::uint32_t> &PronosticStore::owner_ids() const {
+  return owner_ids_;
+}
+
+void PronosticStore::restore(const void *grids,
+                             const std::uint32_t *owner_ids,
+                             std::size_t count,
+                             std::vector<std::string> owners) {
+  if (std::any_of(owner_ids, owner_ids + count,
+                  [size = owners.size()](std::uint32_t id) {
+                    return id >= size;
+                  })) {
+    throw std::invalid_argument{"owner id error"};
+  }
+
+  const unsigned length{parameter_.length()};
+  const unsigned minimum{parameter_.minimum()};
+  const unsigned maximum{parameter_.maximum()};
+
+  if (bitmask()) {
+    Grid::mask_type outside{~std::uint64_t{0}, ~std::uint64_t{0}};
+    for (unsigned value{minimum}; value <= maximum; ++value) {
+      outside[value / 64] &= ~(std::uint64_t{1} << value % 64);
+    }
+    auto first{static_cast<const Grid::mask_type *>(grids)};
+    if (!std::all_of(first, first + count,
+                     [&outside, length](const Grid::mask_type &mask) {
+                       return (mask[0] & outside[0]) == 0
+                              && (mask[1] & outside[1]) == 0
+                              && popcount(mask[0]) + popcount(mask[1])
+                                 == length;
+                     })) {
+      throw std::runtime_error{"corrupted snapshot"};
+    }
+    masks_.assign(first, first + count);
+    values_.clear();
+  } else {
+    auto first{static_cast<const unsigned *>(grids)};
+    auto last{first + count * length};
+    for (auto row{first}; row != last; row += length) {
+      if (row[0] < minimum || row[length - 1] > maximum
+          || std::adjacent_find(row, row + length,
+                                std::greater_equal<unsigned>{})
+             != row + length) {
+        throw std::runtime_error{"corrupted snapshot"};
+      }
+    }
+    values_.assign(first, last);
+    masks_.clear();
+  }
+  owner_ids_.assign(owner_ids, owner_ids + count);
+  owners_ = std::move(owners);
+  owner_index_.clear();
+  owner_index_.reserve(owners_.size());
+  for (std::size_t id{0}; id < owners_.size(); ++id) {
+    owner_index_.emplace(owners_[id], static_cast<std::uint32_t>(id));
+  }
+  owner_pronostics_.assign(owners_.size(), {});
+  for (std::size_t i{0}; i < count; ++i) {
+    owner_pronostics_[owner_ids_[i]].push_back(i);
+  }
+}
+
+std::uint32_t PronosticStore::owner_id(std::size_t index) const {
+  return owner_ids_[index];
+}
+
+const std::string &PronosticStore::owner(std::size_t index) const {
+  return owners_[owner_ids_[index]];
+}
+
+const std::vector<std::string> &PronosticStore::owners() const {
+  return owners_;
+}
+
+std::optional<std::uint32_t>
+PronosticStore::find_owner(const std::string &owner) const {
+  auto position{owner_index_.find(owner)};
+  if (position == std::end(owner_index_)) {
+    return std::nullopt;
+  }
+  return position->second;
+}
+
+const std::vector<std::size_t> &
+PronosticStore::pronostics_of(std::uint32_t owner_id) const {
+  return owner_pronostics_[owner_id];
+}
+
+unsigned PronosticStore::matches(std::size_t index,
+                                 const Grid &grid) const {
+  if (bitmask() && grid.bitmask()) {
+    const auto &mask{masks_[index]};
+    return popcount(mask[0] & grid.mask()[0])
+           + popcount(mask[1] & grid.mask()[1]);
+  }
+  return this->grid(index).matches(grid);
+}
+
+Pronostic PronosticStore::operator[](std::size_t index) const {
+  return Pronostic{owner(index), grid(index), parameter_};
+}
+
+void PronosticStore::write(std::size_t index, std::string &out) const {
+  parameter_.write(out);
+  out.append(" :: { ");
+  if (bitmask()) {
+    for (auto e : Grid{masks_[index]}) {
+      append_number(out, e).push_back(' ');
+    }
+  } else {
+    auto first{std::cbegin(values_) + index * parameter_.length()};
+    for (auto last{first + parameter_.length()}; first != last; ++first) {
+      append_number(out, *first).push_back(' ');
+    }
+  }
+  out.append("} ::: ").append(owner(index));
+}
+
+PronosticStore::const_iterator PronosticStore::begin() const {
+  return {this, 0};
+}
+
+PronosticStore::const_iterator PronosticStore::end() const {
+  return {this, size()};
+}
+
+PronosticStore::const_iterator::const_iterator(const PronosticStore *store,
+                                               std::size_t index) :
+    store_{store},
+    index_{index} {}
+
+PronosticStore::const_iterator::reference
+PronosticStore::const_iterator::operator*() const {
+  return (*store_)[index_];
+}
+
+PronosticStore::const_iterator &PronosticStore::const_iterator::operator++() {
+  ++index_;
+  return *this;
+}
+
+PronosticStore::const_iterator
+PronosticStore::const_iterator::operator++(int) {
+  const_iterator result{*this};
+  ++index_;
+  return result;
+}
+
+bool operator==(const PronosticStore::const_iterator &lhs,
+                const PronosticStore::const_iterator &rhs) {
+  return lhs.store_ == rhs.store_ && lhs.index_ == rhs.index_;
+}
+
+bool operator!=(const PronosticStore::const_iterator &lhs,
+                const PronosticStore::const_iterator &rhs) {
+  return !(lhs == rhs);
+}
+
+}
+
+#endif // STORE_H
@@ -0,0 +1,332 @@
+/**
+ * @file validation.hpp
+ * @brief Définition de fonctions de vérification en lot de
+ *        grilles de lotto.
+ *
+ * @author Andrew SASSOYE <andrew@sasoye.be>
+ * @copyright Copyright © 2020 Andrew SASSOYE. This project is released under the MIT License.
+ */
+#ifndef VALIDATION_H
+#define VALIDATION_H
+
+#include "grid.hpp"
+#include "parameter.hpp"
+#include "preset.hpp"
+#include "parallel.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <tuple>
+
+/*!
+ * \brief Espace de nom du projet Lotto de Nicolas Vansteenkiste.
+ */
+namespace g54327::lotto {
+
+/*!
+ * \brief Erreurs détectées sur une grille.
+ *
+ * Chaque énumérateur est un bit : une grille peut en cumuler
+ * plusieurs.
+ */
+enum class GridError : std::uint8_t {
+  /*! Le nombre de valeurs n'est pas celui du paramétrage. */
+  LENGTH = 1,
+  /*! Une valeur est hors de l'intervalle du paramétrage. */
+  RANGE = 2,
+  /*! Une valeur apparaît plusieurs fois. */
+  DUPLICATE = 4
+};
+
+/*!
+ * \brief Grille refusée et ses erreurs.
+ */
+struct InvalidGrid {
+  /*!
+   * \brief Indice de la grille dans le lot.
+   */
+  std::size_t index;
+
+  /*!
+   * \brief Erreurs de la grille, combinaison de bits de
+   *        GridError.
+   */
+  std::uint8_t errors;
+
+  /*!
+   * \brief Présence d'une erreur.
+   *
+   * \param error erreur recherchée.
+   *
+   * \return `true` si `error` fait partie de \ref errors.
+   */
+  bool has(GridError error) const {
+    return (errors & static_cast<std::uint8_t>(error)) != 0;
+  }
+};
+
+/*!
+ * \brief Résultat de la vérification d'un lot de grilles.
+ *
+ * Le bit `i % 64` du mot `i / 64` de `bitmap` est à 1 si et
+ * seulement si la grille d'indice `i` est refusée. Le détail des
+ * erreurs n'est conservé que pour les grilles refusées, par
+ * indice croissant, dans `invalid`.
+ */
+struct ValidationReport {
+  /*!
+   * \brief Nombre de grilles vérifiées.
+   */
+  std::size_t count;
+
+  /*!
+   * \brief Carte des grilles refusées, un bit par grille.
+   */
+  std::vector<std::uint64_t> bitmap;
+
+  /*!
+   * \brief Grilles refusées, par indice croissant.
+   */
+  std::vector<InvalidGrid> invalid;
+
+  /*!
+   * \brief Validité d'une grille.
+   *
+   * \param index indice de la grille.
+   *
+   * \return `true` si la grille est acceptée.
+   */
+  bool valid(std::size_t index) const {
+    return (bitmap[index / 64] >> index % 64 & 1) == 0;
+  }
+};
+
+// prototypes
+
+/*!
+ * \brief Vérification d'une grille, sans exception.
+ *
+ * Contrairement au constructeur Item::Item(), les doublons ne
+ * sont pas éliminés mais signalés : `{ 1, 2, 2 }` est refusée
+ * pour GridError::DUPLICATE et non pour GridError::LENGTH.
+ *
+ * \param values conteneur quelconque de valeurs, transtypées en
+ *               `unsigned`.
+ * \param parameter paramétrage de lotto.
+ * \param scratch tampon de travail, réutilisé d'un appel à
+ *                l'autre pour les grandes grilles.
+ *
+ * \return combinaison des bits GridError, 0 si la grille est
+ *         valide.
+ */
+template<typename Container>
+inline std::uint8_t check_grid(const Container &values,
+                               const Parameter &parameter,
+                               std::vector<unsigned> &scratch);
+
+/*!
+ * \brief Vérification d'une grille pour un paramétrage connu à la
+ *        compilation, sans exception.
+ *
+ * Même résultat que check_grid(const Container &, const Parameter &,
+ * std::vector<unsigned> &) pour `Preset::PARAMETER_`, mais les
+ * bornes sont des constantes et les doublons sont détectés dans un
+ * masque local. Seule une grille ayant une valeur trop grande pour
+ * le masque, donc refusée, repasse par la version générique.
+ *
+ * \param values conteneur quelconque de valeurs, transtypées en
+ *               `unsigned`.
+ * \param preset paramétrage de lotto.
+ * \param scratch tampon de travail de la version générique.
+ *
+ * \return combinaison des bits GridError, 0 si la grille est
+ *         valide.
+ */
+template<typename Container, unsigned Length, unsigned Maximum,
+         unsigned Minimum>
+inline std::uint8_t check_grid(const Container &values,
+                               Preset<Length, Maximum, Minimum> preset,
+                               std::vector<unsigned> &scratch);
+
+/*!
+ * \brief Vérification parallèle d'un lot de grilles, sans
+ *        exception.
+ *
+ * Chaque élément de `rows` est une paire (ou un tuple) dont le
+ * second élément contient les valeurs de la grille, comme pour
+ * Lotto::add_bulk(). Le lot est découpé en plages contiguës de
+ * multiples de 64 grilles, une par thread, pour que chaque thread
+ * écrive ses propres mots de la carte.
+ *
+ * \param rows lot à accès direct.
+ * \param parameter paramétrage de lotto.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ *
+ * \return la carte des grilles refusées et leurs erreurs.
+ */
+template<typename Range>
+inline ValidationReport validate(const Range &rows,
+                                 const Parameter &parameter,
+                                 unsigned threads = 0);
+
+/*!
+ * \brief Vérification parallèle d'un lot de grilles par une
+ *        fonction donnée.
+ *
+ * Découpage et résultat comme validate(const Range &,
+ * const Parameter &, unsigned), chaque grille étant vérifiée par
+ * `check(values, scratch)`.
+ *
+ * \param rows lot à accès direct.
+ * \param threads nombre de threads, 0 pour le nombre de cœurs.
+ * \param check fonction de vérification d'une grille.
+ *
+ * \return la carte des grilles refusées et leurs erreurs.
+ */
+template<typename Range, typename Check>
+inline ValidationReport validate(const Range &rows, unsigned threads,
+                                 Check check);
+
+// implémentation fonctions inline
+
+template<typename Container>
+std::uint8_t check_grid(const Container &values,
+                        const Parameter &parameter,
+                        std::vector<unsigned> &scratch) {
+  const bool bitmask{parameter.maximum() < Grid::MASK_BITS_};
+  Grid::mask_type mask{};
+  std::size_t count{0};
+  std::uint8_t errors{0};
+  scratch.clear();
+
+  using std::cbegin;
+  using std::cend;
+  for (auto first{cbegin(values)}; first != cend(values); ++first) {
+    auto value{static_cast<unsigned>(*first)};
+    ++count;
+    if (value < parameter.minimum() || value > parameter.maximum()) {
+      errors |= static_cast<std::uint8_t>(GridError::RANGE);
+    }
+    if (bitmask && value < Grid::MASK_BITS_) {
+      auto &word{mask[value / 64]};
+      auto bit{std::uint64_t{1} << value % 64};
+      if ((word & bit) != 0) {
+        errors |= static_cast<std::uint8_t>(GridError::DUPLICATE);
+      }
+      word |= bit;
+    } else {
+      scratch.push_back(value);
+    }
+  }
+
+  if (count != parameter.length()) {
+    errors |= static_cast<std::uint8_t>(GridError::LENGTH);
+  }
+  if (scratch.size() > 1) {
+    std::sort(std::begin(scratch), std::end(scratch));
+    if (std::adjacent_find(std::begin(scratch), std::end(scratch))
+        != std::end(scratch)) {
+      errors |= static_cast<std::uint8_t>(GridError::DUPLICATE);
+    }
+  }
+  return errors;
+}
+
+template<typename Container, unsigned Length, unsigned Maximum,
+         unsigned Minimum>
+std::uint8_t check_grid(const Container &values,
+                        Preset<Length, Maximum, Minimum> preset,
+                        std::vector<unsigned> &scratch) {
+  std::uint64_t low{0};
+  std::uint64_t high{0};
+  std::size_t count{0};
+  std::uint8_t errors{0};
+
+  using std::cbegin;
+  using std::cend;
+  for (auto first{cbegin(values)}; first != cend(values); ++first) {
+    auto value{static_cast<unsigned>(*first)};
+    if (value >= Grid::MASK_BITS_) {
+      return check_grid(values, preset.PARAMETER_, scratch);
+    }
+    ++count;
+    // une seule comparaison grâce au débordement des non signés
+    if (value - Minimum > Maximum - Minimum) {
+      errors |= static_cast<std::uint8_t>(GridError::RANGE);
+    }
+    auto &word{value < 64 ? low : high};
+    auto bit{std::uint64_t{1} << value % 64};
+    if ((word & bit) != 0) {
+      errors |= static_cast<std::uint8_t>(GridError::DUPLICATE);
+    }
+    word |= bit;
+  }
+
+  if (count != Length) {
+    errors |= static_cast<std::uint8_t>(GridError::LENGTH);
+  }
+  return errors;
+}
+
+template<typename Range>
+ValidationReport validate(const Range &rows, const Parameter &parameter,
+                          unsigned threads) {
+  ValidationReport result;
+  if (!with_preset(parameter, [&](auto preset) {
+        result = validate(rows, threads,
+                          [preset](const auto &values,
+                                   std::vector<unsigned> &scratch) {
+                            return check_grid(values, preset, scratch);
+                          });
+      })) {
+    result = validate(rows, threads,
+                      [&parameter](const auto &values,
+                                   std::vector<unsigned> &scratch) {
+                        return check_grid(values, parameter, scratch);
+                      });
+  }
+  return result;
+}
+
+template<typename Range, typename Check>
+ValidationReport validate(const Range &rows, unsigned threads,
+                          Check check) {
+  threads = thread_count(threads);
+
+  using std::begin;
+  using std::end;
+  const auto first{begin(rows)};
+  const std::size_t size{static_cast<std::size_t>(end(rows) - first)};
+  const std::size_t words{(size + 63) / 64};
+
+  ValidationReport result{size, std::vector<std::uint64_t>(words), {}};
+  std::vector<std::vector<InvalidGrid>> partials(threads);
+
+  // plages de mots entiers : un mot de bitmap n'a qu'un écrivain
+  parallel_for(words, threads,
+               [&](unsigned t, std::size_t first_word,
+                   std::size_t last_word) {
+    std::vector<unsigned> scratch;
+    auto last{std::min(size, last_word * 64)};
+    for (auto i{first_word * 64}; i < last; ++i) {
+      auto errors{check(std::get<1>(first[i]), scratch)};
+      if (errors != 0) {
+        result.bitmap[i / 64] |= std::uint64_t{1} << i % 64;
+        partials[t].push_back({i, errors});
+      }
+    }
+  });
+
+  for (const auto &partial : partials) {
+    result.invalid.insert(std::end(result.invalid),
+                          std::begin(partial), std::end(partial));
+  }
+  return result;
+}
+
+}
+
+#endif // VALIDATION_H
@@ -0,0 +1,61 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("CoverageTable compte les pronostics contenant un sous-ensemble", "[Coverage]") {
+    Lotto lotto{3, 10, 1};
+    lotto.add("Bob", {1, 2, 3})
+         .add("Alice", {1, 2, 4})
+         .add("Carol", {1, 2, 3})
+         .add("Dave", {5, 6, 7});
+
+    auto coverage = lotto.coverage();
+    REQUIRE(coverage.size() == 4);
+    REQUIRE(coverage.count(Grid{}) == 4);
+
+    std::vector<unsigned> single{1};
+    std::vector<unsigned> pair{1, 2};
+    std::vector<unsigned> triple{1, 2, 3};
+    std::vector<unsigned> missing{8, 9};
+    std::vector<unsigned> outside{0, 1};
+    REQUIRE(coverage.count(Grid{single.begin(), single.end(), 10}) == 3);
+    REQUIRE(coverage.count(Grid{pair.begin(), pair.end(), 10}) == 3);
+    REQUIRE(coverage.count(Grid{triple.begin(), triple.end(), 10}) == 2);
+    REQUIRE(coverage.count(Grid{missing.begin(), missing.end(), 10}) == 0);
+    REQUIRE(coverage.count(Grid{outside.begin(), outside.end(), 10}) == 0);
+
+    REQUIRE(coverage.match_histogram(Grid{triple.begin(), triple.end(), 10})
+            == std::vector<unsigned long long>{1, 0, 1, 2});
+    REQUIRE_THROWS_AS(coverage.match_histogram(Grid{pair.begin(), pair.end(), 10}),
+                      std::invalid_argument);
+}
+
+TEST_CASE("CoverageTable donne l'histogramme de tout tirage candidat", "[Coverage]") {
+    // 6 parmi 45 : niveaux 5 et 6 hachés ; 5 parmi 20 : tous en tableau
+    for (const auto &parameter : {Parameter{6, 45, 1}, Parameter{5, 20, 3}}) {
+        Lotto lotto{parameter.length(), parameter.maximum(), parameter.minimum()};
+        lotto.add_bulk(nvs::lotto::data(20'000, parameter.length(),
+                                        parameter.maximum(), parameter.minimum()));
+        auto coverage = lotto.coverage(3);
+
+        for (int i = 0; i < 50; ++i) {
+            Draw draw{parameter};
+            std::vector<unsigned long long> expected(parameter.length() + 1);
+            for (std::size_t p = 0; p < lotto.pronostics().size(); ++p) {
+                ++expected[lotto.pronostics().matches(p, draw.values())];
+            }
+            REQUIRE(coverage.match_histogram(draw.values()) == expected);
+        }
+    }
+}
+
+TEST_CASE("CoverageTable refuse les grilles hors masque", "[Coverage]") {
+    Lotto lotto{3, 1000, 1};
+    lotto.add("Bob", {1, 2, 3});
+    REQUIRE_THROWS_AS(lotto.coverage(), std::invalid_argument);
+}
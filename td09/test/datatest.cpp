@@ -0,0 +1,40 @@
+#include "catch2/catch.hpp"
+#include "../resources/data.h"
+
+#include <algorithm>
+
+TEST_CASE("nvs::lotto::data par colonnes", "[data]") {
+    auto columns = nvs::lotto::data(100'000, 6, 45, 1, nvs::seed{42}, 4);
+    REQUIRE(columns.size() == 100'000);
+    REQUIRE(columns.values.size() == 600'000);
+
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        REQUIRE(columns.owner[i] < columns.owners.size());
+        const unsigned *grid = columns.grid(i);
+        REQUIRE(std::is_sorted(grid, grid + 6));
+        REQUIRE(std::adjacent_find(grid, grid + 6) == grid + 6);
+        REQUIRE(grid[0] >= 1);
+        REQUIRE(grid[5] <= 45);
+    }
+}
+
+TEST_CASE("nvs::lotto::data par colonnes est reproductible", "[data]") {
+    auto one = nvs::lotto::data(50'000, 8, 50, 1, nvs::seed{7, 1}, 1);
+    auto many = nvs::lotto::data(50'000, 8, 50, 1, nvs::seed{7, 1}, 8);
+    REQUIRE(one.owner == many.owner);
+    REQUIRE(one.values == many.values);
+
+    auto other = nvs::lotto::data(50'000, 8, 50, 1, nvs::seed{7, 2}, 8);
+    REQUIRE(one.values != other.values);
+
+    REQUIRE_THROWS_AS(nvs::lotto::data(1, 0, 50, 1, nvs::seed{}), std::invalid_argument);
+    REQUIRE_THROWS_AS(nvs::lotto::data(1, 51, 50, 1, nvs::seed{}), std::invalid_argument);
+}
+
+TEST_CASE("nvs::lotto::data", "[data]") {
+    auto pairs = nvs::lotto::data(1000, 6, 45, 1);
+    REQUIRE(pairs.size() == 1000);
+    for (const auto &pair : pairs) {
+        REQUIRE(pair.second.size() == 6);
+    }
+}
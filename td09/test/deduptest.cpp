@@ -0,0 +1,82 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("DistinctGrids regroupe les grilles identiques", "[Dedup]") {
+    for (unsigned maximum : {45u, 1000u}) {
+        Lotto lotto{3, maximum, 1};
+        lotto.add("Bob", {1, 2, 3})
+             .add("Alice", {4, 5, 6})
+             .add("Carol", {3, 2, 1})
+             .add("Bob", {1, 2, 3})
+             .add("Dave", {7, 8, 9});
+
+        auto distinct = lotto.distinct();
+        REQUIRE(distinct.size() == 3);
+        REQUIRE(distinct.pronostic_count() == 5);
+        REQUIRE(distinct.grid(0) == lotto.pronostics().grid(0));
+        REQUIRE(distinct.grid(1) == lotto.pronostics().grid(1));
+        REQUIRE(distinct.grid(2) == lotto.pronostics().grid(4));
+
+        REQUIRE(distinct.multiplicity(0) == 3);
+        REQUIRE(std::vector<std::size_t>(distinct.pronostics(0), distinct.pronostics(0) + 3)
+                == std::vector<std::size_t>{0, 2, 3});
+        auto bob = *lotto.pronostics().find_owner("Bob");
+        auto carol = *lotto.pronostics().find_owner("Carol");
+        REQUIRE(std::vector<std::uint32_t>(distinct.owner_ids(0), distinct.owner_ids(0) + 3)
+                == std::vector<std::uint32_t>{bob, carol, bob});
+        REQUIRE(distinct.group(3) == 0);
+        REQUIRE(distinct.group(4) == 2);
+
+        auto stats = distinct.stats();
+        REQUIRE(stats.pronostics == 5);
+        REQUIRE(stats.distinct == 3);
+        REQUIRE(stats.duplicates() == 2);
+        REQUIRE(stats.max_multiplicity == 3);
+        REQUIRE(stats.ratio() == Approx(5.0 / 3));
+    }
+}
+
+TEST_CASE("DistinctGrids ne dépend pas du nombre de threads", "[Dedup]") {
+    for (unsigned maximum : {12u, 200u}) {
+        Lotto lotto{3, maximum, 1};
+        lotto.add_bulk(nvs::lotto::data(20'000, 3, maximum, 1));
+
+        auto one = lotto.distinct(1);
+        auto many = lotto.distinct(7);
+        REQUIRE(one.size() == many.size());
+        REQUIRE(one.size() < lotto.pronostics().size());
+        std::size_t total = 0;
+        for (std::size_t d = 0; d < one.size(); ++d) {
+            REQUIRE(one.grid(d) == many.grid(d));
+            REQUIRE(one.multiplicity(d) == many.multiplicity(d));
+            total += one.multiplicity(d);
+            for (std::size_t j = 0; j < one.multiplicity(d); ++j) {
+                REQUIRE(one.pronostics(d)[j] == many.pronostics(d)[j]);
+                REQUIRE(lotto.pronostics().grid(one.pronostics(d)[j]) == one.grid(d));
+            }
+        }
+        REQUIRE(total == lotto.pronostics().size());
+    }
+}
+
+TEST_CASE("Lotto::match_histogram sur les grilles distinctes", "[Dedup]") {
+    for (unsigned maximum : {10u, 45u, 1000u}) {
+        Lotto lotto{6, maximum, 1};
+        lotto.add_bulk(nvs::lotto::data(10'000, 6, maximum, 1));
+        auto distinct = lotto.distinct();
+        REQUIRE_THROWS_AS(lotto.match_histogram(distinct), std::logic_error);
+
+        lotto.set_draw();
+        REQUIRE(lotto.match_histogram(distinct, 3) == lotto.match_histogram());
+
+        Lotto other{6, maximum, 1};
+        other.set_draw();
+        REQUIRE_THROWS_AS(other.match_histogram(distinct), std::invalid_argument);
+    }
+}
@@ -0,0 +1,30 @@
+#include "catch2/catch.hpp"
+#include "../src/draw.hpp"
+
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("Draw respecte le paramétrage", "[Draw]") {
+    Parameter parameter{6, 45, 1};
+    for (int i = 0; i < 1000; ++i) {
+        Draw draw{parameter};
+        REQUIRE(draw.values().size() == 6);
+        REQUIRE(*draw.values().begin() >= 1);
+        REQUIRE(*draw.values().rbegin() <= 45);
+    }
+}
+
+TEST_CASE("Draw sur une très grande grille", "[Draw]") {
+    Parameter parameter{8, 1'000'000'000, 1};
+    Draw draw{parameter};
+    REQUIRE(draw.values().size() == 8);
+    REQUIRE(*draw.values().rbegin() <= 1'000'000'000);
+}
+
+TEST_CASE("Draw sur une grille pleine", "[Draw]") {
+    Parameter parameter{5, 9, 5};
+    Draw draw{parameter};
+    REQUIRE(std::vector<unsigned>(draw.values().begin(), draw.values().end())
+            == std::vector<unsigned>{5, 6, 7, 8, 9});
+}
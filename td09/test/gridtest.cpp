@@ -0,0 +1,75 @@
+#include "catch2/catch.hpp"
+#include "../src/grid.hpp"
+#include "../src/pronostic.hpp"
+
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("Grid dans le masque", "[Grid]") {
+    std::vector<unsigned> values{45, 3, 64, 3, 127, 0, 63};
+    Grid grid{values.begin(), values.end(), 127};
+
+    REQUIRE(grid.bitmask());
+    REQUIRE(grid.size() == 6);
+    REQUIRE(std::vector<unsigned>(grid.begin(), grid.end())
+            == std::vector<unsigned>{0, 3, 45, 63, 64, 127});
+    REQUIRE(std::vector<unsigned>(grid.rbegin(), grid.rend())
+            == std::vector<unsigned>{127, 64, 63, 45, 3, 0});
+    REQUIRE(grid.contains(64));
+    REQUIRE_FALSE(grid.contains(65));
+    REQUIRE_FALSE(grid.contains(1000));
+    REQUIRE(grid.mask()[0] == (1ULL << 0 | 1ULL << 3 | 1ULL << 45 | 1ULL << 63));
+    REQUIRE(grid.mask()[1] == (1ULL << 0 | 1ULL << 63));
+}
+
+TEST_CASE("Grid hors du masque", "[Grid]") {
+    std::vector<unsigned> values{1'000'000, 7, 7, 500};
+    Grid grid{values.begin(), values.end(), 1'000'000};
+
+    REQUIRE_FALSE(grid.bitmask());
+    REQUIRE(grid.size() == 3);
+    REQUIRE(std::vector<unsigned>(grid.begin(), grid.end())
+            == std::vector<unsigned>{7, 500, 1'000'000});
+    REQUIRE(*grid.rbegin() == 1'000'000);
+    REQUIRE(grid.count(500) == 1);
+    REQUIRE(grid.count(501) == 0);
+}
+
+TEST_CASE("Grid bascule sur le vecteur pour une valeur trop grande", "[Grid]") {
+    std::vector<unsigned> values{12, 4, 200};
+    Grid grid{values.begin(), values.end(), 45};
+
+    REQUIRE_FALSE(grid.bitmask());
+    REQUIRE(std::vector<unsigned>(grid.begin(), grid.end())
+            == std::vector<unsigned>{4, 12, 200});
+}
+
+TEST_CASE("Grid compte les valeurs communes", "[Grid]") {
+    std::vector<unsigned> a{1, 2, 3, 40, 70, 100};
+    std::vector<unsigned> b{2, 3, 4, 70, 101, 127};
+    std::vector<unsigned> c{2, 3, 4, 70, 101, 1000};
+    Grid lhs{a.begin(), a.end(), 127};
+    Grid rhs{b.begin(), b.end(), 127};
+    Grid big{c.begin(), c.end(), 1000};
+
+    REQUIRE(lhs.matches(rhs) == 3);
+    REQUIRE(rhs.matches(lhs) == 3);
+    REQUIRE(lhs.matches(big) == 3);
+    REQUIRE(big.matches(lhs) == 3);
+    REQUIRE(lhs.matches(lhs) == 6);
+    REQUIRE(lhs == Grid{a.rbegin(), a.rend(), 127});
+    REQUIRE(lhs != rhs);
+    REQUIRE(Grid{} == Grid{a.begin(), a.begin(), 127});
+    REQUIRE(Grid{}.empty());
+}
+
+TEST_CASE("Item refuse les valeurs invalides", "[Grid]") {
+    Parameter parameter{3, 45, 1};
+
+    REQUIRE_NOTHROW(Pronostic{"Bob", {1, 2, 45}, parameter});
+    REQUIRE_THROWS_AS((Pronostic{"Bob", {1, 2, 46}, parameter}), std::invalid_argument);
+    REQUIRE_THROWS_AS((Pronostic{"Bob", {0, 2, 3}, parameter}), std::invalid_argument);
+    REQUIRE_THROWS_AS((Pronostic{"Bob", {1, 2, 200}, parameter}), std::invalid_argument);
+    REQUIRE_THROWS_AS((Pronostic{"Bob", {1, 2, 2}, parameter}), std::invalid_argument);
+}
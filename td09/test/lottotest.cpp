@@ -0,0 +1,206 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace g54327::lotto;
+
+namespace {
+
+unsigned common(const Grid &lhs, const Grid &rhs) {
+    unsigned result = 0;
+    for (auto value : lhs) {
+        result += rhs.contains(value) ? 1 : 0;
+    }
+    return result;
+}
+
+std::vector<std::string> owners(const std::vector<Pronostic> &pronostics) {
+    std::vector<std::string> result;
+    for (const auto &pronostic : pronostics) {
+        result.push_back(pronostic.owner());
+    }
+    return result;
+}
+
+void check_winners(Lotto &lotto, std::size_t count) {
+    const auto &parameter = lotto.parameter();
+    for (std::size_t i = 0; i < count; ++i) {
+        lotto.add(std::to_string(i), nvs::random_sample(parameter.length(),
+                                                        parameter.minimum(),
+                                                        parameter.maximum()));
+    }
+    lotto.set_draw();
+    Draw draw = lotto.draw();
+
+    for (unsigned k = 1; k <= parameter.length(); ++k) {
+        std::vector<std::string> strict;
+        std::vector<std::string> inclusive;
+        for (const auto &pronostic : lotto.pronostics()) {
+            unsigned matches = common(pronostic.values(), draw.values());
+            if (matches == k) {
+                strict.push_back(pronostic.owner());
+            }
+            if (matches >= k) {
+                inclusive.push_back(pronostic.owner());
+            }
+        }
+        REQUIRE(owners(lotto.winner(k)) == strict);
+        REQUIRE(owners(lotto.winner(k, Lotto::Equality::INCLUSIVE)) == inclusive);
+    }
+}
+
+}
+
+TEST_CASE("Lotto::winner sur des grilles en masque", "[Lotto]") {
+    Lotto lotto{6, 20, 1};
+    check_winners(lotto, 10'000);
+}
+
+TEST_CASE("Lotto::winner au-delà de 64", "[Lotto]") {
+    Lotto lotto{4, 127, 60};
+    check_winners(lotto, 10'000);
+}
+
+TEST_CASE("Lotto::winner sur de grandes grilles", "[Lotto]") {
+    Lotto lotto{3, 1000, 995};
+    check_winners(lotto, 1'000);
+}
+
+TEST_CASE("Lotto::winner vérifie ses arguments", "[Lotto]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add("Bob", {1, 2, 3, 4, 5, 6});
+    REQUIRE_THROWS_AS(lotto.winner(1), std::logic_error);
+
+    lotto.set_draw();
+    REQUIRE_THROWS_AS(lotto.winner(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(lotto.winner(7), std::invalid_argument);
+    REQUIRE(lotto.winner(6, Lotto::Equality::INCLUSIVE).size() <= 1);
+    REQUIRE_THROWS_AS(lotto.add("Alice", {1, 2, 3, 4, 5, 6}), std::logic_error);
+}
+
+TEST_CASE("Lotto::match_histogram compte chaque niveau", "[Lotto]") {
+    for (unsigned maximum : {45u, 1000u}) {
+        Lotto lotto{6, maximum, 1};
+        for (int i = 0; i < 20'000; ++i) {
+            lotto.add(std::to_string(i), nvs::random_sample(6u, 1u, maximum));
+        }
+        REQUIRE_THROWS_AS(lotto.match_histogram(), std::logic_error);
+        lotto.set_draw();
+        Draw draw = lotto.draw();
+
+        std::vector<unsigned long long> expected(7);
+        std::vector<std::vector<std::size_t>> expected_winners(7);
+        for (std::size_t i = 0; i < lotto.pronostics().size(); ++i) {
+            unsigned matches = common(lotto.pronostics()[i].values(), draw.values());
+            ++expected[matches];
+            if (matches >= 2) {
+                expected_winners[matches].push_back(i);
+            }
+        }
+
+        for (unsigned threads : {1u, 3u, 8u}) {
+            REQUIRE(lotto.match_histogram(threads) == expected);
+
+            std::vector<std::vector<std::size_t>> winners;
+            REQUIRE(lotto.match_histogram(winners, 2, threads) == expected);
+            REQUIRE(winners == expected_winners);
+        }
+    }
+}
+
+TEST_CASE("Lotto::match_histogram sans pronostic", "[Lotto]") {
+    Lotto lotto;
+    lotto.set_draw();
+    auto histogram = lotto.match_histogram(4);
+    REQUIRE(histogram.size() == lotto.parameter().length() + 1);
+    REQUIRE(std::all_of(histogram.begin(), histogram.end(),
+                        [](unsigned long long count) { return count == 0; }));
+}
+
+TEST_CASE("Lotto::add_bulk équivaut à des add successifs", "[Lotto]") {
+    auto rows = nvs::lotto::data(5'000, 6, 45, 1);
+    Lotto one_by_one{6, 45, 1};
+    for (const auto &[owner, values] : rows) {
+        one_by_one.add(owner, values);
+    }
+
+    Lotto copied{6, 45, 1};
+    copied.add_bulk(rows);
+    Lotto moved{6, 45, 1};
+    moved.add_bulk(std::move(rows));
+
+    for (const Lotto *lotto : {&copied, &moved}) {
+        REQUIRE(lotto->pronostics().size() == one_by_one.pronostics().size());
+        REQUIRE(lotto->pronostics().masks() == one_by_one.pronostics().masks());
+        REQUIRE(lotto->pronostics().owners() == one_by_one.pronostics().owners());
+        for (std::size_t i = 0; i < one_by_one.pronostics().size(); ++i) {
+            REQUIRE(lotto->pronostics().owner_id(i) == one_by_one.pronostics().owner_id(i));
+        }
+    }
+}
+
+TEST_CASE("Lotto::add_bulk s'arrête au premier pronostic refusé", "[Lotto]") {
+    std::vector<std::pair<std::string, std::vector<unsigned>>> rows{
+            {"Bob", {1, 2, 3}},
+            {"Alice", {1, 2, 46}},
+            {"Carol", {4, 5, 6}}};
+    Lotto lotto{3, 45, 1};
+    REQUIRE_THROWS_AS(lotto.add_bulk(rows), std::invalid_argument);
+    REQUIRE(lotto.pronostics().size() == 1);
+
+    lotto.set_draw();
+    REQUIRE_THROWS_AS(lotto.add_bulk(rows), std::logic_error);
+}
+
+namespace {
+
+std::string legacy(const Pronostic &pronostic) {
+    const auto &parameter = pronostic.parameter();
+    std::string result = std::to_string(parameter.length()) + " : ["
+                         + std::to_string(parameter.minimum()) + ".."
+                         + std::to_string(parameter.maximum()) + "] :: { ";
+    for (auto e : pronostic.values()) {
+        result.append(std::to_string(e)).append(" ");
+    }
+    return result.append("} ::: ").append(pronostic.owner());
+}
+
+}
+
+TEST_CASE("Lotto s'écrit au fil de l'eau comme to_string", "[Lotto]") {
+    for (unsigned maximum : {45u, 1000u}) {
+        Lotto lotto{6, maximum, 1};
+        REQUIRE(lotto.to_string() == "{ g } 6 : [1.." + std::to_string(maximum) + "]\nno draw yet");
+
+        lotto.add_bulk(nvs::lotto::data(5'000, 6, maximum, 1));
+        lotto.set_draw();
+
+        std::string expected = "{ g } " + lotto.parameter().to_string() + "\n"
+                               + "{ d } " + lotto.draw().to_string() + "\n"
+                               + "{ p } 5000\n";
+        for (const auto &pronostic : lotto.pronostics()) {
+            expected.append("      ").append(legacy(pronostic)).append("\n");
+        }
+
+        REQUIRE(lotto.to_string() == expected);
+        std::ostringstream out;
+        out << lotto;
+        REQUIRE(out.str() == expected);
+    }
+}
+
+TEST_CASE("Pronostic::to_string garde sa mise en forme", "[Lotto]") {
+    Parameter parameter{3, 45, 1};
+    Pronostic pronostic{"Bob", {45, 7, 12}, parameter};
+    REQUIRE(pronostic.to_string() == "3 : [1..45] :: { 7 12 45 } ::: Bob");
+    REQUIRE(legacy(pronostic) == pronostic.to_string());
+    std::ostringstream out;
+    out << pronostic;
+    REQUIRE(out.str() == pronostic.to_string());
+}
@@ -0,0 +1,105 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("Lotto indexe les pronostics par propriétaire", "[Owner]") {
+    Lotto lotto{3, 45, 1};
+    lotto.add("Bob", {1, 2, 3})
+         .add("Alice", {4, 5, 6})
+         .add("Bob", {7, 8, 9});
+
+    REQUIRE(lotto.pronostics_of("Bob") == std::vector<std::size_t>{0, 2});
+    REQUIRE(lotto.pronostics_of("Alice") == std::vector<std::size_t>{1});
+    REQUIRE(lotto.pronostics_of("Carol").empty());
+
+    auto bob = lotto.summary("Bob");
+    REQUIRE(bob.grids == 2);
+    REQUIRE_FALSE(bob.best_match.has_value());
+    REQUIRE(lotto.summary("Carol").grids == 0);
+
+    auto all = lotto.summaries();
+    REQUIRE(all.size() == 2);
+    REQUIRE(all[0].grids == 2);
+    REQUIRE(all[1].grids == 1);
+    REQUIRE_FALSE(all[0].best_match.has_value());
+}
+
+TEST_CASE("Lotto calcule la meilleure correspondance de chaque propriétaire", "[Owner]") {
+    for (unsigned maximum : {45u, 1000u}) {
+        Lotto lotto{6, maximum, 1};
+        lotto.add_bulk(nvs::lotto::data(20'000, 6, maximum, 1));
+        lotto.set_draw();
+        Draw draw = lotto.draw();
+        const auto &pronostics = lotto.pronostics();
+
+        std::vector<unsigned> best(pronostics.owners().size());
+        std::vector<std::size_t> grids(pronostics.owners().size());
+        for (std::size_t i = 0; i < pronostics.size(); ++i) {
+            auto id = pronostics.owner_id(i);
+            best[id] = std::max(best[id], pronostics.grid(i).matches(draw.values()));
+            ++grids[id];
+        }
+
+        for (unsigned threads : {1u, 5u}) {
+            auto all = lotto.summaries(threads);
+            REQUIRE(all.size() == pronostics.owners().size());
+            for (std::size_t id = 0; id < all.size(); ++id) {
+                REQUIRE(all[id].grids == grids[id]);
+                REQUIRE(all[id].best_match == best[id]);
+            }
+        }
+        for (std::size_t id = 0; id < pronostics.owners().size(); ++id) {
+            auto summary = lotto.summary(pronostics.owners()[id]);
+            REQUIRE(summary.grids == grids[id]);
+            REQUIRE(summary.best_match == best[id]);
+            for (auto i : lotto.pronostics_of(pronostics.owners()[id])) {
+                REQUIRE(pronostics.owner_id(i) == id);
+            }
+        }
+    }
+}
+
+TEST_CASE("Lotto::summaries au-delà de 255 valeurs communes", "[Owner]") {
+    // au moins 290 valeurs communes avec tout tirage de 300 valeurs sur 310
+    Lotto lotto{300, 310, 1};
+    for (unsigned shift : {0u, 10u, 5u}) {
+        std::vector<unsigned> values(300);
+        std::iota(values.begin(), values.end(), 1 + shift);
+        lotto.add(shift == 10 ? "Alice" : "Bob", values);
+    }
+    lotto.set_draw();
+    const auto &pronostics = lotto.pronostics();
+    REQUIRE_FALSE(pronostics.bitmask());
+
+    std::vector<unsigned> best(2);
+    for (std::size_t i = 0; i < pronostics.size(); ++i) {
+        auto id = pronostics.owner_id(i);
+        best[id] = std::max(best[id], pronostics.grid(i).matches(lotto.draw().values()));
+    }
+    REQUIRE(best[0] >= 290);
+
+    for (unsigned threads : {1u, 2u, 5u}) {
+        auto all = lotto.summaries(threads);
+        REQUIRE(all[0].best_match == best[0]);
+        REQUIRE(all[1].best_match == best[1]);
+    }
+}
+
+TEST_CASE("Snapshot reconstruit l'index des propriétaires", "[Owner]") {
+    Lotto lotto{3, 45, 1};
+    lotto.add("Bob", {1, 2, 3}).add("Alice", {4, 5, 6}).add("Bob", {7, 8, 9});
+    lotto.save("ownertest.bin");
+    Lotto restored{Snapshot{"ownertest.bin"}};
+    std::remove("ownertest.bin");
+
+    REQUIRE(restored.pronostics_of("Bob") == std::vector<std::size_t>{0, 2});
+    REQUIRE(restored.pronostics_of("Alice") == std::vector<std::size_t>{1});
+}
@@ -0,0 +1,67 @@
+#include "catch2/catch.hpp"
+#include "../src/parallel.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("thread_count remplace 0 par le nombre de cœurs", "[Parallel]") {
+    REQUIRE(thread_count(3) == 3);
+    REQUIRE(thread_count(0) >= 1);
+}
+
+TEST_CASE("run_threads appelle la fonction une fois par thread", "[Parallel]") {
+    std::vector<std::atomic<int>> calls(5);
+    run_threads(5, [&calls](unsigned t) { ++calls[t]; });
+    for (const auto &call : calls) {
+        REQUIRE(call == 1);
+    }
+}
+
+TEST_CASE("parallel_for couvre chaque indice une fois", "[Parallel]") {
+    for (std::size_t size : {0u, 1u, 3u, 1000u, 1001u}) {
+        for (unsigned threads : {1u, 4u, 7u}) {
+            // les assertions de Catch ne se font que dans le thread principal
+            std::vector<std::atomic<int>> seen(size);
+            std::vector<std::size_t> firsts(threads, 0);
+            std::vector<std::size_t> lasts(threads, 0);
+            parallel_for(size, threads,
+                         [&](unsigned t, std::size_t first, std::size_t last) {
+                firsts[t] = first;
+                lasts[t] = last;
+                for (auto i = first; i < last; ++i) {
+                    ++seen[i];
+                }
+            });
+            for (const auto &count : seen) {
+                REQUIRE(count == 1);
+            }
+            // plages contiguës dans l'ordre des threads
+            REQUIRE(firsts[0] == 0);
+            for (unsigned t = 1; t < threads; ++t) {
+                if (lasts[t] != 0) {
+                    REQUIRE(firsts[t] == lasts[t - 1]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("parallel_histogram additionne les compteurs des threads", "[Parallel]") {
+    for (unsigned threads : {1u, 3u, 8u}) {
+        auto counts = parallel_histogram(
+            10'000, 7, threads,
+            [](unsigned, std::size_t first, std::size_t last,
+               unsigned long long *local) {
+                for (auto i = first; i < last; ++i) {
+                    ++local[i % 7];
+                }
+            });
+        REQUIRE(counts.size() == 7);
+        for (std::size_t k = 0; k < 7; ++k) {
+            REQUIRE(counts[k] == (10'000 - k + 6) / 7);
+        }
+    }
+}
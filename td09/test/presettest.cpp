@@ -0,0 +1,70 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("with_preset n'aiguille que les paramétrages connus", "[Preset]") {
+    unsigned length = 0;
+    REQUIRE(with_preset(Parameter{6, 45, 1}, [&](auto preset) {
+        length = decltype(preset)::PARAMETER_.length();
+    }));
+    REQUIRE(length == 6);
+    REQUIRE(with_preset(Parameter{}, [](auto preset) {
+        REQUIRE(decltype(preset)::WORDS_ == 1);
+        REQUIRE(decltype(preset)::LEVELS_ == 9);
+    }));
+
+    bool called = false;
+    REQUIRE_FALSE(with_preset(Parameter{6, 45, 2}, [&](auto) { called = true; }));
+    REQUIRE_FALSE(with_preset(Parameter{6, 1000, 1}, [&](auto) { called = true; }));
+    REQUIRE_FALSE(called);
+}
+
+TEST_CASE("Preset::histogram compte comme le noyau générique", "[Preset]") {
+    using Lotto645 = Preset<6, 45, 1>;
+    PronosticStore store{Lotto645::PARAMETER_};
+    for (const auto &row : nvs::lotto::data(10'003, 6, 45, 1)) {
+        store.add(row.first, row.second);
+    }
+    Draw draw{Lotto645::PARAMETER_};
+
+    std::vector<unsigned char> levels(store.size());
+    matches(store.masks().data(), store.size(), draw.values().mask(), levels.data());
+    std::vector<unsigned long long> expected(Lotto645::LEVELS_);
+    for (auto level : levels) {
+        ++expected[level];
+    }
+
+    std::vector<unsigned long long> actual(Lotto645::LEVELS_);
+    Lotto645::histogram(store.masks().data(), store.size(),
+                        draw.values().mask(), actual.data());
+    REQUIRE(actual == expected);
+
+    std::vector<unsigned char> preset(store.size());
+    Lotto645::matches(store.masks().data(), store.size(),
+                      draw.values().mask(), preset.data());
+    REQUIRE(preset == levels);
+}
+
+TEST_CASE("check_grid donne le même résultat avec un Preset", "[Preset]") {
+    using Lotto645 = Preset<6, 45, 1>;
+    std::vector<unsigned> scratch;
+    const std::vector<std::vector<unsigned>> grids{
+        {1, 2, 3, 4, 5, 6},
+        {1, 2, 3, 4, 5},
+        {0, 2, 3, 4, 5, 6},
+        {1, 2, 3, 4, 5, 46},
+        {1, 2, 3, 4, 5, 5},
+        {0, 0, 3, 4, 5, 6},
+        {1, 2, 3, 4, 5, 127, 127},
+        {1, 2, 3, 4, 5, 5000, 5000},
+        {},
+    };
+    for (const auto &grid : grids) {
+        REQUIRE(check_grid(grid, Lotto645{}, scratch)
+                == check_grid(grid, Lotto645::PARAMETER_, scratch));
+    }
+}
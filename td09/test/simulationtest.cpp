@@ -0,0 +1,111 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("simulate compte chaque pronostic une fois par tirage", "[Simulation]") {
+    for (unsigned maximum : {45u, 100u, 1000u}) {
+        Lotto lotto{6, maximum, 1};
+        lotto.add_bulk(nvs::lotto::data(5'000, 6, maximum, 1));
+
+        auto result = lotto.simulate(40, nvs::seed{2020, 0}, 3);
+        REQUIRE(result.draws == 40);
+        REQUIRE(result.levels() == 7);
+        REQUIRE_FALSE(lotto.has_draw());
+
+        const auto &pronostics = lotto.pronostics();
+        for (std::size_t d = 0; d < result.draws; ++d) {
+            std::vector<unsigned> values(result.draw_values(d),
+                                         result.draw_values(d) + 6);
+            Draw draw{values, lotto.parameter()};
+
+            std::vector<unsigned long long> expected(7);
+            for (std::size_t i = 0; i < pronostics.size(); ++i) {
+                ++expected[pronostics.matches(i, draw.values())];
+            }
+            std::vector<unsigned long long> actual(result.histogram(d),
+                                                   result.histogram(d) + 7);
+            REQUIRE(actual == expected);
+        }
+    }
+}
+
+TEST_CASE("simulate ne dépend pas du nombre de threads", "[Simulation]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add_bulk(nvs::lotto::data(10'000, 6, 45, 1));
+
+    auto one = lotto.simulate(50, nvs::seed{7, 1}, 1);
+    auto many = lotto.simulate(50, nvs::seed{7, 1}, 8);
+    REQUIRE(one.values == many.values);
+    REQUIRE(one.histograms == many.histograms);
+
+    auto other = lotto.simulate(50, nvs::seed{7, 2}, 8);
+    REQUIRE(other.values != one.values);
+}
+
+TEST_CASE("simulate ne rejoue pas les blocs de data() de même graine", "[Simulation]") {
+    // taille d'un bloc de nvs::lotto::data()
+    const std::size_t CHUNK = 1u << 14;
+    const nvs::seed seed{};
+    Parameter parameter{6, 45, 1};
+    auto columns = nvs::lotto::data(4 * CHUNK, 6, 45, 1, seed);
+
+    Lotto lotto{6, 45, 1};
+    lotto.add_bulk(nvs::lotto::data(100, 6, 45, 1));
+    auto result = lotto.simulate(4, seed, 2);
+
+    for (std::size_t d = 0; d < 4; ++d) {
+        // premier pronostic du bloc d : propriétaire puis grille
+        auto engine = nvs::urng(seed);
+        engine.discard(d << 40);
+        nvs::random_value(0u, static_cast<unsigned>(columns.owners.size()) - 1, engine);
+        Draw chunk{parameter, engine};
+        REQUIRE(std::equal(cbegin(chunk.values()), cend(chunk.values()),
+                           columns.grid(d * CHUNK)));
+
+        engine = nvs::urng(seed);
+        engine.discard(d << 40);
+        Draw replay{parameter, engine};
+
+        std::vector<unsigned> simulated(result.draw_values(d), result.draw_values(d) + 6);
+        REQUIRE(Draw(simulated, parameter).values() != replay.values());
+        REQUIRE(Draw(simulated, parameter).values() != chunk.values());
+
+        engine = nvs::urng(nvs::seed{seed.value, seed.stream ^ SIMULATION_STREAM});
+        engine.discard(d << 40);
+        REQUIRE(Draw(simulated, parameter).values() == Draw(parameter, engine).values());
+    }
+}
+
+TEST_CASE("SimulationResult::statistics résume les histogrammes", "[Simulation]") {
+    Lotto lotto{3, 10, 1};
+    lotto.add("Bob", {1, 2, 3}).add("Alice", {4, 5, 6});
+
+    auto result = lotto.simulate(200, nvs::seed{}, 4);
+    auto statistics = result.statistics();
+    REQUIRE(statistics.size() == 4);
+
+    double total = 0;
+    for (const auto &level : statistics) {
+        total += level.mean;
+        REQUIRE(level.minimum <= level.maximum);
+        REQUIRE(level.maximum <= 2);
+        REQUIRE(level.hit_rate >= 0);
+        REQUIRE(level.hit_rate <= 1);
+    }
+    REQUIRE(total == Approx(2));
+
+    std::size_t jackpots = 0;
+    for (std::size_t d = 0; d < result.draws; ++d) {
+        jackpots += result.histogram(d)[3] != 0 ? 1 : 0;
+    }
+    REQUIRE(statistics[3].hit_rate == Approx(jackpots / 200.0));
+
+    auto empty = lotto.simulate(0, nvs::seed{});
+    REQUIRE(empty.statistics(0).mean == 0);
+}
@@ -0,0 +1,191 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace g54327::lotto;
+
+namespace {
+
+const std::string PATH = "snapshottest.bin";
+
+void check_same(const Lotto &lhs, const Lotto &rhs) {
+    REQUIRE(lhs.parameter().to_string() == rhs.parameter().to_string());
+    REQUIRE(lhs.has_draw() == rhs.has_draw());
+    REQUIRE(lhs.pronostics().size() == rhs.pronostics().size());
+    REQUIRE(lhs.pronostics().masks() == rhs.pronostics().masks());
+    REQUIRE(lhs.pronostics().values() == rhs.pronostics().values());
+    REQUIRE(lhs.pronostics().owner_ids() == rhs.pronostics().owner_ids());
+    REQUIRE(lhs.pronostics().owners() == rhs.pronostics().owners());
+    if (lhs.has_draw()) {
+        REQUIRE(lhs.draw().values() == rhs.draw().values());
+        REQUIRE(lhs.match_histogram(1) == rhs.match_histogram(1));
+    }
+}
+
+}
+
+TEST_CASE("Snapshot restaure un lotto en masques", "[Snapshot]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add_bulk(nvs::lotto::data(10'000, 6, 45, 1));
+    lotto.add("Zoé", {1, 2, 3, 4, 5, 6});
+
+    lotto.save(PATH);
+    check_same(Lotto{Snapshot{PATH}}, lotto);
+
+    lotto.set_draw();
+    lotto.save(PATH);
+    Lotto restored{Snapshot{PATH}};
+    check_same(restored, lotto);
+    REQUIRE_THROWS_AS(restored.add("Bob", {1, 2, 3, 4, 5, 6}), std::logic_error);
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("Snapshot restaure un lotto en valeurs triées", "[Snapshot]") {
+    Lotto lotto{3, 1000, 1};
+    lotto.add_bulk(nvs::lotto::data(1'000, 3, 1000, 1));
+    lotto.set_draw();
+
+    lotto.save(PATH);
+    Snapshot snapshot{PATH};
+    REQUIRE_FALSE(snapshot.bitmask());
+    REQUIRE(snapshot.size() == 1'000);
+    check_same(Lotto{snapshot}, lotto);
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("Snapshot refuse un fichier invalide", "[Snapshot]") {
+    REQUIRE_THROWS_AS(Snapshot{"snapshottest-absent.bin"}, std::runtime_error);
+
+    Lotto lotto{6, 45, 1};
+    lotto.add("Bob", {1, 2, 3, 4, 5, 6});
+    lotto.save(PATH);
+
+    std::FILE *file = std::fopen(PATH.c_str(), "ab");
+    std::fputc(0, file);
+    std::fclose(file);
+    REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+
+    file = std::fopen(PATH.c_str(), "r+b");
+    std::fputs("NOTLOTTO", file);
+    std::fclose(file);
+    REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+    std::remove(PATH.c_str());
+}
+
+namespace {
+
+template<typename T>
+void patch(long offset, const T &value) {
+    std::FILE *file = std::fopen(PATH.c_str(), "r+b");
+    std::fseek(file, offset, SEEK_SET);
+    std::fwrite(&value, sizeof(T), 1, file);
+    std::fclose(file);
+}
+
+// en-tête de 56 octets, pas de tirage : les grilles suivent
+const long GRIDS = 56;
+
+}
+
+TEST_CASE("Snapshot refuse un masque corrompu", "[Snapshot]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add("Bob", {1, 2, 3, 4, 5, 6});
+    lotto.add("Alice", {40, 41, 42, 43, 44, 45});
+
+    const Grid::mask_type invalid[] = {
+        {0b1111110, 0},         // 1..6 : valide
+        {0b11111110, 0},        // sept valeurs
+        {0b1111101, 0},         // 0 hors grille
+        {0b111110, 1},          // 64 hors grille
+    };
+    for (std::size_t i = 0; i < std::size(invalid); ++i) {
+        lotto.save(PATH);
+        patch(GRIDS + 16, invalid[i]);
+        if (i == 0) {
+            Lotto restored{Snapshot{PATH}};
+            REQUIRE(restored.pronostics().grid(1) == lotto.pronostics().grid(0));
+        } else {
+            REQUIRE_THROWS_AS(Lotto{Snapshot{PATH}}, std::runtime_error);
+        }
+    }
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("Snapshot refuse des valeurs corrompues", "[Snapshot]") {
+    Lotto lotto{3, 1000, 1};
+    lotto.add("Bob", {1, 2, 3});
+    lotto.add("Alice", {998, 999, 1000});
+
+    using Row = std::array<std::uint32_t, 3>;
+    const Row invalid[] = {
+        {1, 500, 1000},         // valide
+        {5, 5, 7},              // doublon
+        {7, 5, 9},              // non triées
+        {0, 5, 9},              // sous le minimum
+        {5, 9, 1001},           // au-delà du maximum
+    };
+    for (std::size_t i = 0; i < std::size(invalid); ++i) {
+        lotto.save(PATH);
+        patch(GRIDS + 12, invalid[i]);
+        if (i == 0) {
+            Lotto restored{Snapshot{PATH}};
+            REQUIRE(restored.pronostics().grid(1).matches(lotto.pronostics().grid(0)) == 1);
+        } else {
+            REQUIRE_THROWS_AS(Lotto{Snapshot{PATH}}, std::runtime_error);
+        }
+    }
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("Snapshot refuse une table des propriétaires corrompue", "[Snapshot]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add("Bob", {1, 2, 3, 4, 5, 6});
+    lotto.add("Alice", {1, 2, 3, 4, 5, 6});
+    // masques puis identifiants : 56 + 2 * 16 + 8 octets
+    const long offsets = GRIDS + 2 * 16 + 8;
+
+    lotto.save(PATH);
+    {
+        Snapshot snapshot{PATH};
+        REQUIRE(snapshot.owner(0) == "Bob");
+        REQUIRE(snapshot.owner(1) == "Alice");
+    }
+
+    patch(offsets + 8, std::uint64_t{9});
+    REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+
+    lotto.save(PATH);
+    patch(offsets, std::uint64_t{1});
+    REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("Snapshot refuse des tailles de section qui débordent", "[Snapshot]") {
+    Lotto lotto{6, 45, 1};
+    lotto.add("Bob", {1, 2, 3, 4, 5, 6});
+
+    // count, owner_count puis owner_bytes suivent les six champs de 32 bits
+    const long count = 8 + 6 * 4;
+    for (long field : {count, count + 8, count + 16}) {
+        lotto.save(PATH);
+        patch(field, std::uint64_t{1} << 62);
+        REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+        patch(field, ~std::uint64_t{0});
+        REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+    }
+
+    Lotto values{3, 1000, 1};
+    values.add("Bob", {1, 2, 3});
+    values.save(PATH);
+    patch(count, std::uint64_t{1} << 61);
+    REQUIRE_THROWS_AS(Snapshot{PATH}, std::runtime_error);
+    std::remove(PATH.c_str());
+}
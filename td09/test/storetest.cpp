@@ -0,0 +1,67 @@
+#include "catch2/catch.hpp"
+#include "../src/store.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("PronosticStore range les grilles en masques", "[PronosticStore]") {
+    Parameter parameter{3, 45, 1};
+    PronosticStore store{parameter};
+    store.add("Bob", std::vector<unsigned>{45, 1, 20})
+         .add("Alice", std::vector<int>{2, 3, 4})
+         .add("Bob", std::vector<unsigned>{7, 8, 9});
+
+    REQUIRE(store.bitmask());
+    REQUIRE(store.size() == 3);
+    REQUIRE(store.masks().size() == 3);
+    REQUIRE(store.owners() == std::vector<std::string>{"Bob", "Alice"});
+    REQUIRE(store.owner_id(0) == store.owner_id(2));
+    REQUIRE(store.owner(1) == "Alice");
+
+    Grid grid = store.grid(0);
+    REQUIRE(std::vector<unsigned>(grid.begin(), grid.end())
+            == std::vector<unsigned>{1, 20, 45});
+
+    Pronostic pronostic = store[2];
+    REQUIRE(pronostic.owner() == "Bob");
+    REQUIRE(pronostic.to_string()
+            == Pronostic("Bob", {7, 8, 9}, parameter).to_string());
+
+    std::vector<std::string> owners;
+    for (const auto &e : store) {
+        owners.push_back(e.owner());
+    }
+    REQUIRE(owners == std::vector<std::string>{"Bob", "Alice", "Bob"});
+}
+
+TEST_CASE("PronosticStore range les grandes grilles triées", "[PronosticStore]") {
+    Parameter parameter{3, 1000, 1};
+    PronosticStore store{parameter};
+    store.reserve(2);
+    store.add("Bob", std::vector<unsigned>{1000, 1, 500});
+    store.add(Pronostic{"Alice", {4, 3, 2}, parameter});
+
+    REQUIRE_FALSE(store.bitmask());
+    REQUIRE(store.masks().empty());
+    Grid grid = store.grid(0);
+    REQUIRE(std::vector<unsigned>(grid.begin(), grid.end())
+            == std::vector<unsigned>{1, 500, 1000});
+
+    std::vector<unsigned> draw{2, 500, 999};
+    REQUIRE(store.matches(0, Grid{draw.begin(), draw.end(), 1000}) == 1);
+    REQUIRE(store.matches(1, Grid{draw.begin(), draw.end(), 1000}) == 1);
+}
+
+TEST_CASE("PronosticStore vérifie les grilles comme Item", "[PronosticStore]") {
+    PronosticStore store{Parameter{3, 45, 1}};
+
+    REQUIRE_THROWS_WITH(store.add("Bob", std::vector<unsigned>{1, 2}), "size error");
+    REQUIRE_THROWS_WITH(store.add("Bob", std::vector<unsigned>{1, 2, 2}), "size error");
+    REQUIRE_THROWS_WITH(store.add("Bob", std::vector<unsigned>{0, 2, 3}), "value error");
+    REQUIRE_THROWS_WITH(store.add("Bob", std::vector<unsigned>{1, 2, 46}), "value error");
+    REQUIRE_THROWS_WITH(store.add("Bob", std::vector<unsigned>{1, 2, 300}), "value error");
+    REQUIRE(store.empty());
+    REQUIRE(store.owners().empty());
+}
@@ -0,0 +1,75 @@
+#include "catch2/catch.hpp"
+#include "../src/lotto.hpp"
+#include "../resources/data.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace g54327::lotto;
+
+TEST_CASE("check_grid signale chaque erreur", "[Validation]") {
+    std::vector<unsigned> scratch;
+    Parameter small{3, 45, 1};
+    Parameter big{3, 1000, 1};
+
+    for (const Parameter *parameter : {&small, &big}) {
+        REQUIRE(check_grid(std::vector<unsigned>{1, 2, 3}, *parameter, scratch) == 0);
+        REQUIRE(check_grid(std::vector<unsigned>{1, 2}, *parameter, scratch)
+                == static_cast<std::uint8_t>(GridError::LENGTH));
+        REQUIRE(check_grid(std::vector<unsigned>{0, 2, 3}, *parameter, scratch)
+                == static_cast<std::uint8_t>(GridError::RANGE));
+        REQUIRE(check_grid(std::vector<unsigned>{1, 2, 2}, *parameter, scratch)
+                == static_cast<std::uint8_t>(GridError::DUPLICATE));
+        REQUIRE(check_grid(std::vector<unsigned>{5000, 5000}, *parameter, scratch)
+                == (static_cast<std::uint8_t>(GridError::LENGTH)
+                    | static_cast<std::uint8_t>(GridError::RANGE)
+                    | static_cast<std::uint8_t>(GridError::DUPLICATE)));
+    }
+    REQUIRE(check_grid(std::vector<unsigned>{1, 2, 46}, small, scratch)
+            == static_cast<std::uint8_t>(GridError::RANGE));
+    REQUIRE(check_grid(std::vector<unsigned>{1, 2, 46}, big, scratch) == 0);
+}
+
+TEST_CASE("validate produit la carte des grilles refusées", "[Validation]") {
+    auto rows = nvs::lotto::data(10'000, 6, 45, 1);
+    rows[0].second[0] = 0;
+    rows[63].second.pop_back();
+    rows[64].second[1] = rows[64].second[0];
+    rows[9'999].second.push_back(46);
+
+    for (unsigned threads : {1u, 3u, 16u}) {
+        auto report = validate(rows, Parameter{6, 45, 1}, threads);
+        REQUIRE(report.count == rows.size());
+        REQUIRE(report.bitmap.size() == (rows.size() + 63) / 64);
+        REQUIRE(report.invalid.size() == 4);
+        REQUIRE(report.invalid[0].index == 0);
+        REQUIRE(report.invalid[0].has(GridError::RANGE));
+        REQUIRE(report.invalid[1].index == 63);
+        REQUIRE(report.invalid[1].has(GridError::LENGTH));
+        REQUIRE(report.invalid[2].index == 64);
+        REQUIRE(report.invalid[2].has(GridError::DUPLICATE));
+        REQUIRE(report.invalid[3].index == 9'999);
+        REQUIRE(report.invalid[3].has(GridError::LENGTH));
+        REQUIRE(report.invalid[3].has(GridError::RANGE));
+        REQUIRE_FALSE(report.valid(64));
+        REQUIRE(report.valid(65));
+    }
+}
+
+TEST_CASE("Lotto::try_add_bulk n'ajoute que les pronostics valides", "[Validation]") {
+    std::vector<std::pair<std::string, std::vector<unsigned>>> rows{
+            {"Bob", {1, 2, 3}},
+            {"Alice", {1, 2, 46}},
+            {"Carol", {4, 5, 6}},
+            {"Dave", {7, 7, 8}}};
+    Lotto lotto{3, 45, 1};
+
+    auto report = lotto.try_add_bulk(rows, 2);
+    REQUIRE(report.invalid.size() == 2);
+    REQUIRE(lotto.pronostics().size() == 2);
+    REQUIRE(lotto.pronostics().owners() == std::vector<std::string>{"Bob", "Carol"});
+
+    lotto.set_draw();
+    REQUIRE_THROWS_AS(lotto.try_add_bulk(rows), std::logic_error);
+}